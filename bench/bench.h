@@ -0,0 +1,27 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+// the benchmark firmware runs on a simavr supported core, and reports progress
+// to db-synth-bench-run by writing markers to GPIOR0. the current combination
+// is stored in GPIOR1 (waveform) and GPIOR2 (adsr type << 4 | filter type)
+// before BENCH_MARKER_COMBINATION is written.
+
+#define bench_mcu "atmega1284p"
+#define bench_gpior0_addr 0x3e
+#define bench_gpior1_addr 0x4a
+#define bench_gpior2_addr 0x4b
+
+typedef enum {
+    BENCH_MARKER_NONE,
+    BENCH_MARKER_COMBINATION,
+    BENCH_MARKER_START,
+    BENCH_MARKER_STOP,
+    BENCH_MARKER_DONE,
+} bench_marker_t;
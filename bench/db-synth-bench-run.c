@@ -0,0 +1,212 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// runs the benchmark firmware under simavr, and reports the cycles spent
+// rendering each block for every waveform, adsr type and filter type
+// combination. exits with an error if any block misses its deadline.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sim_avr.h>
+#include <sim_elf.h>
+#include <sim_io.h>
+#include "bench.h"
+#include "synth.h"
+#include "main-data.h"
+
+static const char *waveforms[] = {"square", "sine", "triangle", "saw", "noise", "pulse", "fm"};
+static const char *adsr_types[] = {"exp", "linear"};
+static const char *filter_types[] = {"off", "low-pass", "high-pass"};
+
+typedef struct {
+    uint8_t waveform;
+    uint8_t adsr_type;
+    uint8_t filter_type;
+    uint64_t min;
+    uint64_t max;
+    uint64_t sum;
+    uint64_t count;
+} result_t;
+
+typedef struct {
+    result_t results[OSCILLATOR_WAVEFORM__LAST * ADSR_TYPE__LAST * FILTER_TYPE__LAST];
+    size_t results_len;
+    result_t *current;
+    avr_cycle_count_t start;
+    uint64_t overhead;
+    bool calibrating;
+    bool done;
+    bool error;
+} state_t;
+
+
+static void
+usage(FILE *f)
+{
+    fprintf(f,
+        "usage: db-synth-bench-run [-h] [-b BUDGET] ELF\n"
+        "\n"
+        "runs the db-synth benchmark firmware (ELF) under simavr.\n"
+        "\n"
+        "options:\n"
+        "  -h         show this help message and exit\n"
+        "  -b BUDGET  cycles available per sample (default: %d)\n",
+        timer_tcb_ccmp);
+}
+
+
+static void
+gpior0_write_cb(avr_t *avr, avr_io_addr_t addr, uint8_t v, void *param)
+{
+    state_t *s = param;
+    avr->data[addr] = v;
+
+    switch ((bench_marker_t) v) {
+    case BENCH_MARKER_COMBINATION: {
+        uint8_t wf = avr->data[bench_gpior1_addr];
+        uint8_t types = avr->data[bench_gpior2_addr];
+        if (wf == 0xff && types == 0xff) {
+            s->calibrating = true;
+            s->current = NULL;
+            break;
+        }
+
+        s->calibrating = false;
+        if (s->results_len >= sizeof(s->results) / sizeof(s->results[0]) ||
+            wf >= OSCILLATOR_WAVEFORM__LAST || (types >> 4) >= ADSR_TYPE__LAST ||
+            (types & 0xf) >= FILTER_TYPE__LAST) {
+            s->error = true;
+            break;
+        }
+
+        s->current = &s->results[s->results_len++];
+        s->current->waveform = wf;
+        s->current->adsr_type = types >> 4;
+        s->current->filter_type = types & 0xf;
+        s->current->min = UINT64_MAX;
+        break;
+    }
+
+    case BENCH_MARKER_START:
+        s->start = avr->cycle;
+        break;
+
+    case BENCH_MARKER_STOP: {
+        uint64_t cycles = avr->cycle - s->start;
+        if (s->calibrating) {
+            s->overhead = cycles;
+            break;
+        }
+        if (s->current == NULL) {
+            s->error = true;
+            break;
+        }
+        cycles -= s->overhead;
+        if (cycles < s->current->min)
+            s->current->min = cycles;
+        if (cycles > s->current->max)
+            s->current->max = cycles;
+        s->current->sum += cycles;
+        s->current->count++;
+        break;
+    }
+
+    case BENCH_MARKER_DONE:
+        s->done = true;
+        break;
+
+    default:
+        break;
+    }
+}
+
+
+int
+main(int argc, char **argv)
+{
+    uint32_t budget = timer_tcb_ccmp;
+
+    int c;
+    while ((c = getopt(argc, argv, "hb:")) != -1) {
+        switch (c) {
+        case 'h':
+            usage(stdout);
+            return 0;
+
+        case 'b':
+            budget = strtoul(optarg, NULL, 10);
+            break;
+
+        default:
+            usage(stderr);
+            return 1;
+        }
+    }
+
+    if (argc - optind != 1) {
+        usage(stderr);
+        return 1;
+    }
+
+    elf_firmware_t fw = {0};
+    if (elf_read_firmware(argv[optind], &fw) != 0) {
+        fprintf(stderr, "error: failed to read firmware: %s\n", argv[optind]);
+        return 1;
+    }
+
+    avr_t *avr = avr_make_mcu_by_name(bench_mcu);
+    if (avr == NULL) {
+        fprintf(stderr, "error: simavr does not support %s\n", bench_mcu);
+        return 1;
+    }
+    avr_init(avr);
+    avr->frequency = 24000000;
+    avr->log = LOG_ERROR;
+    avr_load_firmware(avr, &fw);
+
+    static state_t state;
+    avr_register_io_write(avr, bench_gpior0_addr, gpior0_write_cb, &state);
+
+    int st = cpu_Running;
+    while (!state.done && !state.error && st != cpu_Done && st != cpu_Crashed)
+        st = avr_run(avr);
+
+    if (!state.done || state.error) {
+        fprintf(stderr, "error: benchmark firmware did not complete\n");
+        return 1;
+    }
+
+    uint64_t block_budget = (uint64_t) budget * synth_block_len;
+    bool fail = false;
+
+    printf("cycles per block of %d samples, budget: %llu (%u per sample)\n\n",
+        synth_block_len, (unsigned long long) block_budget, budget);
+    printf("%-10s %-8s %-10s %8s %8s %8s %8s\n", "WAVEFORM", "ADSR", "FILTER", "MIN", "AVG", "MAX", "MAX/SMP");
+    for (size_t i = 0; i < state.results_len; i++) {
+        result_t *r = &state.results[i];
+        if (r->count == 0)
+            continue;
+        bool over = r->max > block_budget;
+        fail |= over;
+        printf("%-10s %-8s %-10s %8llu %8llu %8llu %8llu%s\n",
+            waveforms[r->waveform], adsr_types[r->adsr_type], filter_types[r->filter_type],
+            (unsigned long long) r->min, (unsigned long long) (r->sum / r->count),
+            (unsigned long long) r->max, (unsigned long long) (r->max / synth_block_len),
+            over ? "  OVER BUDGET" : "");
+    }
+
+    if (fail) {
+        fprintf(stderr, "\nerror: worst case block exceeds the cycle budget\n");
+        return 1;
+    }
+
+    return 0;
+}
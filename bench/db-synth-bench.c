@@ -0,0 +1,94 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include <avr/sleep.h>
+#include <string.h>
+#include "bench.h"
+#include "synth.h"
+
+// blocks rendered for each note event. long enough to go through every
+// envelope stage with the parameters below.
+#define bench_blocks 1000
+
+static synth_t synth;
+static uint16_t block[synth_block_len];
+
+
+static void
+render(uint16_t blocks)
+{
+    for (uint16_t i = 0; i < blocks; i++) {
+        GPIOR0 = BENCH_MARKER_START;
+        synth_render_block(&synth, block, synth_block_len);
+        GPIOR0 = BENCH_MARKER_STOP;
+    }
+}
+
+
+static void
+midi(midi_command_t cmd, uint8_t b0, uint8_t b1)
+{
+    uint8_t buf[2] = {b0, b1};
+    synth_midi_channel(&synth, cmd, buf, 2);
+}
+
+
+int
+main(void)
+{
+    // calibration, measures the overhead of the markers
+    GPIOR1 = 0xff;
+    GPIOR2 = 0xff;
+    GPIOR0 = BENCH_MARKER_COMBINATION;
+    GPIOR0 = BENCH_MARKER_START;
+    GPIOR0 = BENCH_MARKER_STOP;
+
+    for (uint8_t wf = 0; wf < OSCILLATOR_WAVEFORM__LAST; wf++) {
+        for (uint8_t at = 0; at < ADSR_TYPE__LAST; at++) {
+            for (uint8_t ft = 0; ft < FILTER_TYPE__LAST; ft++) {
+                GPIOR1 = wf;
+                GPIOR2 = (at << 4) | ft;
+                GPIOR0 = BENCH_MARKER_COMBINATION;
+
+                memset(&synth, 0, sizeof(synth));
+                synth_init(&synth, NULL, NULL);
+                synth_set_param(&synth, SYNTH_PARAM_OSCILLATOR_WAVEFORM, wf);
+                synth_set_param(&synth, SYNTH_PARAM_ADSR_TYPE, at);
+                synth_set_param(&synth, SYNTH_PARAM_ADSR_ATTACK, 0x10);
+                synth_set_param(&synth, SYNTH_PARAM_ADSR_DECAY, 0x10);
+                synth_set_param(&synth, SYNTH_PARAM_ADSR_SUSTAIN, 0x60);
+                synth_set_param(&synth, SYNTH_PARAM_ADSR_RELEASE, 0x10);
+                synth_set_param(&synth, SYNTH_PARAM_FILTER_TYPE, ft);
+                synth_set_param(&synth, SYNTH_PARAM_FILTER_CUTOFF, 0x3f);
+
+                // pitch is the most expensive lfo destination
+                synth_set_param(&synth, SYNTH_PARAM_LFO_RATE, 0x60);
+                synth_set_param(&synth, SYNTH_PARAM_LFO_DEPTH, 0x7f);
+
+                render(bench_blocks / 10);  // idle
+                midi(MIDI_NOTE_ON, 36, 0x7f);
+                render(bench_blocks);
+                midi(MIDI_NOTE_ON, 96, 0x7f);  // note change at zero crossing
+                render(bench_blocks);
+                midi(MIDI_NOTE_OFF, 96, 0);
+                render(bench_blocks);
+            }
+        }
+    }
+
+    GPIOR0 = BENCH_MARKER_DONE;
+
+    // simavr stops when sleeping with interrupts disabled
+    cli();
+    sleep_enable();
+    sleep_cpu();
+
+    return 0;
+}
@@ -31,7 +31,7 @@ endfunction()
 function(avr_target_generate_hex target)
     add_custom_command(
         OUTPUT ${target}.hex
-        COMMAND ${AVR_OBJCOPY} -j .text -j .data -O ihex $<TARGET_FILE:${target}> ${target}.hex
+        COMMAND ${AVR_OBJCOPY} -j .text -j .rodata -j .data -O ihex $<TARGET_FILE:${target}> ${target}.hex
         DEPENDS $<TARGET_FILE:${target}>
     )
     add_custom_target(${target}-hex
@@ -5,11 +5,12 @@
 
 #pragma once
 
+#include <avr/pgmspace.h>
 #include <stdint.h>
 
 #define adsr_sample_amplitude 0xff
 
-static const uint8_t adsr_curve_as3310_attack[256] = {
+static const uint8_t adsr_curve_as3310_attack[256] PROGMEM = {
     0x00, 0x01, 0x03, 0x04, 0x06, 0x08, 0x09, 0x0b, 0x0d, 0x0e, 0x10, 0x11, 0x13, 0x15, 0x16, 0x18,
     0x19, 0x1b, 0x1c, 0x1e, 0x20, 0x21, 0x23, 0x24, 0x26, 0x27, 0x29, 0x2a, 0x2c, 0x2d, 0x2f, 0x30,
     0x31, 0x33, 0x34, 0x36, 0x37, 0x39, 0x3a, 0x3c, 0x3d, 0x3e, 0x40, 0x41, 0x42, 0x44, 0x45, 0x47,
@@ -29,7 +30,7 @@ static const uint8_t adsr_curve_as3310_attack[256] = {
 };
 #define adsr_curve_as3310_attack_len 256
 
-static const uint8_t adsr_curve_as3310_decay_release[256] = {
+static const uint8_t adsr_curve_as3310_decay_release[256] PROGMEM = {
     0x00, 0x03, 0x06, 0x09, 0x0c, 0x0f, 0x12, 0x15, 0x18, 0x1a, 0x1d, 0x20, 0x23, 0x26, 0x28, 0x2b,
     0x2e, 0x30, 0x33, 0x35, 0x38, 0x3a, 0x3d, 0x3f, 0x42, 0x44, 0x46, 0x49, 0x4b, 0x4d, 0x4f, 0x52,
     0x54, 0x56, 0x58, 0x5a, 0x5c, 0x5e, 0x60, 0x62, 0x64, 0x66, 0x68, 0x6a, 0x6c, 0x6e, 0x70, 0x71,
@@ -49,7 +50,7 @@ static const uint8_t adsr_curve_as3310_decay_release[256] = {
 };
 #define adsr_curve_as3310_decay_release_len 256
 
-static const uint8_t adsr_curve_linear[256] = {
+static const uint8_t adsr_curve_linear[256] PROGMEM = {
     0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
     0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
     0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
@@ -69,7 +70,7 @@ static const uint8_t adsr_curve_linear[256] = {
 };
 #define adsr_curve_linear_len 256
 
-static const uint32_t adsr_time_steps[128] = {
+static const uint32_t adsr_time_steps[128] PROGMEM = {
     0x0002aaaa, 0x00013604, 0x0000c52d, 0x00008eb7, 0x00006eab, 0x00005995, 0x00004aaa, 0x00003f92,
     0x00003700, 0x00003030, 0x00002aa7, 0x00002611, 0x00002236, 0x00001eed, 0x00001c19, 0x000019a4,
     0x0000177c, 0x00001596, 0x000013e5, 0x00001263, 0x00001109, 0x00000fd0, 0x00000eb5, 0x00000db4,
@@ -6,12 +6,23 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <avr/pgmspace.h>
+#include <assert.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include "adsr.h"
 #include "adsr-data.h"
 
+// the envelope levels are 16 bits, the 8-bit curves are scaled to the full
+// range.
+#define level_amplitude ((uint16_t) adsr_sample_amplitude * 0x101)
+
+static_assert(adsr_curve_linear_len > adsr_time_steps_len, "curves must have a point after the last time step");
+static_assert(adsr_curve_as3310_attack_len > adsr_time_steps_len, "curves must have a point after the last time step");
+static_assert(adsr_curve_as3310_decay_release_len > adsr_time_steps_len, "curves must have a point after the last time step");
+
 
 void
 adsr_init(adsr_t *a)
@@ -22,7 +33,13 @@ adsr_init(adsr_t *a)
     a->_initialized = true;
     a->_state = ADSR_STATE_OFF;
     a->_sustain = 0x7f;
-    a->_sustain_level = a->_sustain << 1;
+    a->_sustain_level = a->_sustain * 0x202;
+
+#if ADSR_CONTROL_RATE > 1
+    a->_ramp = 0;
+    a->_ramp_step = 0;
+    a->_ramp_left = 0;
+#endif
 }
 
 
@@ -37,7 +54,7 @@ _set_state(adsr_t *a, adsr_state_t s)
 
     switch (a->_state) {
     case ADSR_STATE_ATTACK:
-        a->_range_end = adsr_sample_amplitude;
+        a->_range_end = level_amplitude;
         break;
 
     case ADSR_STATE_DECAY:
@@ -57,6 +74,11 @@ _set_state(adsr_t *a, adsr_state_t s)
     }
 
     a->_time.data = 0;
+
+#if ADSR_CONTROL_RATE > 1
+    // start a new ramp right away, from the current output level.
+    a->_ramp_left = 0;
+#endif
 }
 
 
@@ -98,7 +120,7 @@ adsr_set_sustain(adsr_t *a, uint8_t sustain)
 {
     if (a != NULL && a->_initialized && a->_sustain != sustain && sustain < 0x80) {
         a->_sustain = sustain;
-        a->_sustain_level = sustain << 1;
+        a->_sustain_level = sustain * 0x202;
         return true;
     }
     return false;
@@ -130,73 +152,264 @@ adsr_unset_gate(adsr_t *a, bool force)
 }
 
 
-static bool
-time_step(adsr_time_t *t, uint8_t idx)
+adsr_state_t
+adsr_get_state(adsr_t *a)
 {
-    if (t == NULL)
-        return false;
-
-    t->data += adsr_time_steps[idx];
-    if (t->pint >= adsr_time_steps_len) {
-        t->pint -= adsr_time_steps_len;
-        return true;
-    }
-    return false;
+    if (a == NULL || !a->_initialized)
+        return ADSR_STATE_OFF;
+    return a->_state;
 }
 
 
-uint8_t
-adsr_get_sample_level(adsr_t *a)
+uint16_t
+adsr_get_level(adsr_t *a)
 {
     if (a == NULL || !a->_initialized)
         return 0;
+    return a->_level;
+}
+
+
+static inline uint16_t
+blend(uint16_t range_start, uint16_t range_end, uint16_t balance)
+{
+#ifdef __AVR__
+    // the low byte products only carry into the dropped bytes, and are
+    // skipped. the host version below must drop them too.
+    uint16_t rv;
+    uint8_t tmp;
+    uint8_t zero;
+    asm volatile (
+        "clr %3"         "\n\t"  // zero = 0
+        "mul %B5, %B2"   "\n\t"  // $result = range_end[h] * balance[h] (unsigned multiplication)
+        "movw %A0, r0"   "\n\t"  // rv = $result
+        "mul %A5, %B2"   "\n\t"  // $result = range_end[l] * balance[h] (unsigned multiplication)
+        "mov %1, r0"     "\n\t"  // tmp = $result[l]
+        "add %A0, r1"    "\n\t"  // rv[l] += $result[h]
+        "adc %B0, %3"    "\n\t"  // rv[h] += $carry
+        "mul %B5, %A2"   "\n\t"  // $result = range_end[h] * balance[l] (unsigned multiplication)
+        "add %1, r0"     "\n\t"  // tmp += $result[l]
+        "adc %A0, r1"    "\n\t"  // rv[l] += $result[h] + $carry
+        "adc %B0, %3"    "\n\t"  // rv[h] += $carry
+        "com %A2"        "\n\t"  // balance[l] = balance[l] complement to 0xff
+        "com %B2"        "\n\t"  // balance[h] = balance[h] complement to 0xff
+        "mul %B4, %B2"   "\n\t"  // $result = range_start[h] * balance[h] (unsigned multiplication)
+        "add %A0, r0"    "\n\t"  // rv[l] += $result[l]
+        "adc %B0, r1"    "\n\t"  // rv[h] += $result[h] + $carry
+        "mul %A4, %B2"   "\n\t"  // $result = range_start[l] * balance[h] (unsigned multiplication)
+        "add %1, r0"     "\n\t"  // tmp += $result[l]
+        "adc %A0, r1"    "\n\t"  // rv[l] += $result[h] + $carry
+        "adc %B0, %3"    "\n\t"  // rv[h] += $carry
+        "mul %B4, %A2"   "\n\t"  // $result = range_start[h] * balance[l] (unsigned multiplication)
+        "add %1, r0"     "\n\t"  // tmp += $result[l]
+        "adc %A0, r1"    "\n\t"  // rv[l] += $result[h] + $carry
+        "adc %B0, %3"    "\n\t"  // rv[h] += $carry
+        "clr r1"         "\n\t"  // $r1 = 0 (avr-libc convention)
+        : "=&r" (rv), "=&r" (tmp), "+r" (balance), "=&r" (zero)
+        : "r" (range_start), "r" (range_end)
+    );
+    return rv;
+#else
+    uint16_t cbalance = ~balance;
+    uint32_t high = (uint16_t) ((range_end >> 8) * (balance >> 8)) + (uint16_t) ((range_start >> 8) * (cbalance >> 8));
+    uint32_t mid = (uint16_t) ((range_end & 0xff) * (balance >> 8)) + (uint16_t) ((range_end >> 8) * (balance & 0xff)) +
+        (uint16_t) ((range_start & 0xff) * (cbalance >> 8)) + (uint16_t) ((range_start >> 8) * (cbalance & 0xff));
+    return ((high << 16) + (mid << 8)) >> 16;
+#endif
+}
+
+
+static inline uint16_t
+curve_level(const uint8_t *table, adsr_time_t t)
+{
+    // interpolate between the 8-bit curve points with the top byte of the
+    // time fraction, so that slow envelopes don't move in audible steps.
+    uint8_t v0 = pgm_read_byte(&table[t.pint]);
+    uint8_t v1 = pgm_read_byte(&table[t.pint + 1]);
+    return (uint16_t) v0 * 0x101 + (uint16_t) (v1 - v0) * (uint8_t) (t.pfrac >> 8);
+}
 
-    const uint8_t *table = NULL;
+
+static inline bool
+get_curve(adsr_t *a, const uint8_t **table, uint8_t *idx)
+{
+    // the state of the adsr_t pointer is checked by the caller.
 
     switch (a->_state) {
     case ADSR_STATE_ATTACK:
-        if (time_step(&a->_time, a->_attack))
-            _set_state(a, ADSR_STATE_DECAY);
-        table = a->_type == ADSR_TYPE_LINEAR ? adsr_curve_linear : adsr_curve_as3310_attack;
+        *idx = a->_attack;
+        *table = a->_type == ADSR_TYPE_LINEAR ? adsr_curve_linear : adsr_curve_as3310_attack;
+        return true;
+
+    case ADSR_STATE_DECAY:
+        *idx = a->_decay;
+        *table = a->_type == ADSR_TYPE_LINEAR ? adsr_curve_linear : adsr_curve_as3310_decay_release;
+        return true;
+
+    case ADSR_STATE_RELEASE:
+        *idx = a->_release;
+        *table = a->_type == ADSR_TYPE_LINEAR ? adsr_curve_linear : adsr_curve_as3310_decay_release;
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+
+static inline uint16_t
+next_state(adsr_t *a, const uint8_t *table)
+{
+    // the state of the adsr_t pointer is checked by the caller.
+
+    switch (a->_state) {
+    case ADSR_STATE_ATTACK:
+        _set_state(a, ADSR_STATE_DECAY);
+        a->_level = blend(a->_range_start, a->_range_end, (uint16_t) pgm_read_byte(&table[0]) * 0x101);
         break;
 
     case ADSR_STATE_DECAY:
-        if (time_step(&a->_time, a->_decay))
-            _set_state(a, ADSR_STATE_SUSTAIN);
-        else
-            table = a->_type == ADSR_TYPE_LINEAR ? adsr_curve_linear : adsr_curve_as3310_decay_release;
+        _set_state(a, ADSR_STATE_SUSTAIN);
+        a->_level = blend(a->_range_start, a->_range_end, level_amplitude);
         break;
 
     case ADSR_STATE_RELEASE:
-        if (time_step(&a->_time, a->_release)) {
-            _set_state(a, ADSR_STATE_OFF);
-            return 0;
-        }
-        table = a->_type == ADSR_TYPE_LINEAR ? adsr_curve_linear : adsr_curve_as3310_decay_release;
+        // the next attack starts from the level, that must be silence.
+        _set_state(a, ADSR_STATE_OFF);
+        a->_level = 0;
         break;
 
-    case ADSR_STATE_SUSTAIN:
+    default:
         break;
+    }
+    return a->_level;
+}
 
-    case ADSR_STATE_OFF:
+
+#if ADSR_CONTROL_RATE > 1
+
+static inline uint16_t
+next_control_level(adsr_t *a)
+{
+    // the state of the adsr_t pointer is checked by the caller.
+
+    const uint8_t *table;
+    uint8_t idx;
+
+    if (!get_curve(a, &table, &idx)) {
+        if (a->_state == ADSR_STATE_SUSTAIN)
+            return blend(a->_range_start, a->_range_end, level_amplitude);
         return 0;
     }
 
-    uint8_t balance = table != NULL ? table[a->_time.pint] : adsr_sample_amplitude;
+    a->_time.data += pgm_read_dword(&adsr_time_steps[idx]) * ADSR_CONTROL_RATE;
+    if (a->_time.pint < adsr_time_steps_len)
+        return blend(a->_range_start, a->_range_end, curve_level(table, a->_time));
 
-    uint16_t tmp;
-    asm volatile (
-        "mul %2, %3"   "\n\t"  // $result = range_end * balance (unsigned multiplication)
-        "movw %A0, r0" "\n\t"  // tmp = $result
-        "com %3"       "\n\t"  // balance = balance complement to 0xff
-        "mul %1, %3"   "\n\t"  // $result = range_start * balance (unsigned multiplication)
-        "add %A0, r0"  "\n\t"  // tmp[l] += $result[l]
-        "adc %B0, r1"  "\n\t"  // tmp[h] += $result[h] + $carry
-        "mov %A0, %B0" "\n\t"  // tmp[l] = tmp[h]
-        "clr r1"       "\n\t"  // $r1 = 0 (avr-libc convention)
-        : "=&r" (tmp)
-        : "r" (a->_range_start), "r" (a->_range_end), "r" (balance)
-    );
-    a->_level = tmp;
-    return a->_level;
+    return next_state(a, table);
+}
+
+
+void
+adsr_render_block(adsr_t *a, uint16_t *buf, uint8_t n)
+{
+    if (a == NULL || !a->_initialized) {
+        memset(buf, 0, n * sizeof(uint16_t));
+        return;
+    }
+
+    // the envelope is computed once every ADSR_CONTROL_RATE samples, and the
+    // output ramps linearly to it. _level holds the envelope at the last
+    // control point.
+    uint16_t ramp = a->_ramp;
+    int16_t ramp_step = a->_ramp_step;
+    uint8_t ramp_left = a->_ramp_left;
+
+    for (uint8_t i = 0; i < n; i++) {
+        if (ramp_left == 0) {
+            a->_level = next_control_level(a);
+
+            if (a->_state == ADSR_STATE_OFF || (a->_state == ADSR_STATE_SUSTAIN && ramp == a->_level)) {
+                // envelope is flat, no need to ramp.
+                for (; i < n; i++)
+                    buf[i] = a->_level;
+                a->_ramp = a->_level;
+                a->_ramp_left = 0;
+                return;
+            }
+
+            // halve the values to fit the difference in 16 bits
+            int16_t diff = (a->_level >> 1) - (ramp >> 1);
+            ramp_step = diff / (ADSR_CONTROL_RATE / 2);
+            ramp_left = ADSR_CONTROL_RATE;
+        }
+
+        // land exactly on the control point, to avoid rounding drift
+        if (--ramp_left == 0)
+            ramp = a->_level;
+        else
+            ramp += ramp_step;
+        buf[i] = ramp;
+    }
+
+    a->_ramp = ramp;
+    a->_ramp_step = ramp_step;
+    a->_ramp_left = ramp_left;
+}
+
+#else
+
+void
+adsr_render_block(adsr_t *a, uint16_t *buf, uint8_t n)
+{
+    if (a == NULL || !a->_initialized) {
+        memset(buf, 0, n * sizeof(uint16_t));
+        return;
+    }
+
+    uint8_t i = 0;
+
+    while (i < n) {
+        const uint8_t *table;
+        uint8_t idx;
+
+        if (!get_curve(a, &table, &idx)) {
+            a->_level = a->_state == ADSR_STATE_SUSTAIN ? blend(a->_range_start, a->_range_end, level_amplitude) : 0;
+            for (; i < n; i++)
+                buf[i] = a->_level;
+            return;
+        }
+
+        // state, curve, ranges and time step only change when the time wraps,
+        // keep them out of the inner loop.
+        uint32_t step = pgm_read_dword(&adsr_time_steps[idx]);
+        uint16_t range_start = a->_range_start;
+        uint16_t range_end = a->_range_end;
+        adsr_time_t t = a->_time;
+
+        for (; i < n; i++) {
+            t.data += step;
+            if (t.pint >= adsr_time_steps_len)
+                break;
+            buf[i] = blend(range_start, range_end, curve_level(table, t));
+        }
+        a->_time = t;
+        if (i > 0)
+            a->_level = buf[i - 1];
+        if (i == n)
+            return;
+
+        buf[i++] = next_state(a, table);
+    }
+}
+
+#endif
+
+
+uint16_t
+adsr_get_sample_level(adsr_t *a)
+{
+    uint16_t rv;
+    adsr_render_block(a, &rv, 1);
+    return rv;
 }
@@ -11,6 +11,12 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// the envelope can be computed at a lower control rate, with linear ramps at
+// audio rate in between. must be a power of 2, 1 means audio rate.
+#ifndef ADSR_CONTROL_RATE
+#define ADSR_CONTROL_RATE 1
+#endif
+
 typedef enum {
     ADSR_STATE_OFF,
     ADSR_STATE_ATTACK,
@@ -40,12 +46,17 @@ typedef struct {
     uint8_t _attack;
     uint8_t _decay;
     uint8_t _sustain;
-    uint8_t _sustain_level;
+    uint16_t _sustain_level;
     uint8_t _release;
-    uint8_t _level;
-    uint8_t _range_start;
-    uint8_t _range_end;
+    uint16_t _level;
+    uint16_t _range_start;
+    uint16_t _range_end;
     adsr_time_t _time;
+#if ADSR_CONTROL_RATE > 1
+    uint16_t _ramp;
+    int16_t _ramp_step;
+    uint8_t _ramp_left;
+#endif
 } adsr_t;
 
 void adsr_init(adsr_t *a);
@@ -56,4 +67,7 @@ bool adsr_set_sustain(adsr_t *a, uint8_t sustain);
 bool adsr_set_release(adsr_t *a, uint8_t release);
 void adsr_set_gate(adsr_t *a);
 void adsr_unset_gate(adsr_t *a, bool force);
-uint8_t adsr_get_sample_level(adsr_t *a);
+adsr_state_t adsr_get_state(adsr_t *a);
+uint16_t adsr_get_level(adsr_t *a);
+uint16_t adsr_get_sample_level(adsr_t *a);
+void adsr_render_block(adsr_t *a, uint16_t *buf, uint8_t n);
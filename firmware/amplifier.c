@@ -10,22 +10,60 @@
 #include "amplifier.h"
 
 
-int16_t
-amplifier_get_sample(int16_t in, uint8_t level1, uint8_t level2)
+static inline int16_t
+amplify(int16_t in, uint16_t level1, uint8_t level2)
 {
+#ifdef __AVR__
+    // the product of the low bytes of the input and the level only carries
+    // into the dropped bytes, and is skipped. the host version below must
+    // drop it too.
     int16_t rv;
+    uint16_t level;
+    uint8_t tmp;
+    uint8_t zero;
     asm volatile (
-        "mul %2, %3"     "\n\t"  // $result = level1 * level2 (unsigned multiplication)
-        "mov %B0, r1"    "\n\t"  // rv[h] ($tmp) = $result[h]
-        "mul %A1, %B0"   "\n\t"  // $result = in[l] * rv[h] ($tmp) (unsigned multiplication)
-        "mov %A0, r1"    "\n\t"  // rv[l] = $result[h]
-        "mulsu %B1, %B0" "\n\t"  // $result = in[h] * rv[h] ($tmp) (signed multiplication)
-        "add %A0, r0"    "\n\t"  // rv[l] += $result[l]
-        "clr %B0"        "\n\t"  // rv[h] = 0
-        "adc %B0, r1"    "\n\t"  // rv[h] += $result[h] + $carry
-        "clr r1"         "\n\t"  // $r1 = 0 (avr-libc convention)
-        : "=&a" (rv)
+        "clr %3"          "\n\t"  // zero = 0
+        "mul %A5, %6"     "\n\t"  // $result = level1[l] * level2 (unsigned multiplication)
+        "mov %2, r1"      "\n\t"  // tmp = $result[h]
+        "mul %B5, %6"     "\n\t"  // $result = level1[h] * level2 (unsigned multiplication)
+        "movw %A1, r0"    "\n\t"  // level = $result
+        "add %A1, %2"     "\n\t"  // level[l] += tmp
+        "adc %B1, %3"     "\n\t"  // level[h] += $carry
+        "mulsu %B4, %B1"  "\n\t"  // $result = in[h] * level[h] (signed multiplication)
+        "movw %A0, r0"    "\n\t"  // rv = $result
+        "mul %A4, %B1"    "\n\t"  // $result = in[l] * level[h] (unsigned multiplication)
+        "mov %2, r0"      "\n\t"  // tmp = $result[l]
+        "add %A0, r1"     "\n\t"  // rv[l] += $result[h]
+        "adc %B0, %3"     "\n\t"  // rv[h] += $carry
+        "mulsu %B4, %A1"  "\n\t"  // $result = in[h] * level[l] (signed multiplication)
+        "sbc %B0, %3"     "\n\t"  // rv[h] -= $carry (sign extension of $result)
+        "add %2, r0"      "\n\t"  // tmp += $result[l]
+        "adc %A0, r1"     "\n\t"  // rv[l] += $result[h] + $carry
+        "adc %B0, %3"     "\n\t"  // rv[h] += $carry
+        "clr r1"          "\n\t"  // $r1 = 0 (avr-libc convention)
+        : "=&r" (rv), "=&a" (level), "=&r" (tmp), "=&r" (zero)
         : "a" (in), "r" (level1), "r" (level2)
     );
     return rv;
+#else
+    uint16_t level = ((uint32_t) level1 * level2) >> 8;
+    int32_t high = (int8_t) (in >> 8) * (level >> 8);
+    int32_t mid = (int8_t) (in >> 8) * (level & 0xff) + (in & 0xff) * (level >> 8);
+    return (high * 0x10000 + mid * 0x100) >> 16;
+#endif
+}
+
+
+int16_t
+amplifier_get_sample(int16_t in, uint16_t level1, uint8_t level2)
+{
+    return amplify(in, level1, level2);
+}
+
+
+void
+amplifier_render_block(int16_t *buf, const uint16_t *level1, uint8_t level2, uint8_t n)
+{
+    for (uint8_t i = 0; i < n; i++)
+        buf[i] = amplify(buf[i], level1[i], level2);
 }
@@ -10,4 +10,5 @@
 
 #include <stdint.h>
 
-int16_t amplifier_get_sample(int16_t in, uint8_t level1, uint8_t level2);
+int16_t amplifier_get_sample(int16_t in, uint16_t level1, uint8_t level2);
+void amplifier_render_block(int16_t *buf, const uint16_t *level1, uint8_t level2, uint8_t n);
@@ -5,13 +5,14 @@
 
 #pragma once
 
+#include <avr/pgmspace.h>
 #include <stdint.h>
 
 static const struct {
     int8_t a1;
     int8_t b0;
     int8_t b1;
-} filter_lowpass_onepole_coefficients[128] = {
+} filter_lowpass_onepole_coefficients[128] PROGMEM = {
     {
         0x7f, 0x00, 0x00,
     },
@@ -403,7 +404,7 @@ static const struct {
     int8_t a1;
     int8_t b0;
     int8_t b1;
-} filter_highpass_onepole_coefficients[128] = {
+} filter_highpass_onepole_coefficients[128] PROGMEM = {
     {
         0x7f, 0x7f, 0x81,
     },
@@ -6,9 +6,11 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <avr/pgmspace.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include "filter.h"
 #include "filter-data.h"
 
@@ -22,6 +24,7 @@ filter_init(filter_t *f)
     f->_initialized = true;
     f->_type = FILTER_TYPE_OFF;
     f->_cutoff = 0x7f;
+    f->_cutoff_mod = 0;
     f->_prev_out = 0;
     f->_prev_in = 0;
 }
@@ -49,41 +52,26 @@ filter_set_cutoff(filter_t *f, uint8_t cutoff)
 }
 
 
-int16_t
-filter_get_sample(filter_t *f, int16_t in)
+void
+filter_set_cutoff_mod(filter_t *f, int8_t mod)
 {
-    if (f == NULL || !f->_initialized)
-        return 0;
-
-    int8_t a1;
-    int8_t b0;
-    int8_t b1;
-
-    switch (f->_type) {
-    case FILTER_TYPE_LOW_PASS:
-        a1 = filter_lowpass_onepole_coefficients[f->_cutoff].a1;
-        b0 = filter_lowpass_onepole_coefficients[f->_cutoff].b0;
-        b1 = filter_lowpass_onepole_coefficients[f->_cutoff].b1;
-        break;
-
-    case FILTER_TYPE_HIGH_PASS:
-        a1 = filter_highpass_onepole_coefficients[f->_cutoff].a1;
-        b0 = filter_highpass_onepole_coefficients[f->_cutoff].b0;
-        b1 = filter_highpass_onepole_coefficients[f->_cutoff].b1;
-        break;
+    // offset added to the cutoff index, without changing the cutoff setting.
+    if (f != NULL && f->_initialized)
+        f->_cutoff_mod = mod;
+}
 
-    case FILTER_TYPE_OFF:
-    case FILTER_TYPE__LAST:
-        return in;
-    }
 
+static inline int16_t
+onepole(int8_t a1, int8_t b0, int8_t b1, int16_t prev_out, int16_t in, int16_t prev_in)
+{
+#ifdef __AVR__
     int16_t rv;
 
     // a1 * y[n-1] + b0 * x[n]
     asm volatile (
-        "muls %3, %B1"  "\n\t"  // $result = a1 * _prev_out[h] (signed * signed)
+        "muls %3, %B1"  "\n\t"  // $result = a1 * prev_out[h] (signed * signed)
         "movw %A0, r0"  "\n\t"  // rv = $result
-        "mulsu %3, %A1" "\n\t"  // $result = a1 * _prev_out[l] (signed * unsigned)
+        "mulsu %3, %A1" "\n\t"  // $result = a1 * prev_out[l] (signed * unsigned)
         "clr r0"        "\n\t"  // $r0 = 0
         "sbc %B0, r0"   "\n\t"  // rv[h] -= 0 + $carry
         "add %A0, r1"   "\n\t"  // rv[l] += $result[h]
@@ -98,15 +86,15 @@ filter_get_sample(filter_t *f, int16_t in)
         "adc %B0, r0"   "\n\t"  // rv[h] += 0 + $carry
         "clr r1"        "\n\t"  // $r1 = 0 (avr-libc convention)
         : "=&d" (rv)
-        : "a" (f->_prev_out), "a" (in), "a" (a1), "a" (b0)
+        : "a" (prev_out), "a" (in), "a" (a1), "a" (b0)
     );
 
     // + b1 * x[n-1], then >> 7
     asm volatile (
-        "muls %1, %B2"  "\n\t"  // $result = b1 * _prev_in[h] (signed * signed)
+        "muls %1, %B2"  "\n\t"  // $result = b1 * prev_in[h] (signed * signed)
         "add %A0, r0"   "\n\t"  // rv[l] += $result[l]
         "adc %B0, r1"   "\n\t"  // rv[h] += $result[h] + $carry
-        "mulsu %1, %A2" "\n\t"  // $result = b1 * _prev_in[l] (signed * unsigned)
+        "mulsu %1, %A2" "\n\t"  // $result = b1 * prev_in[l] (signed * unsigned)
         "clr r0"        "\n\t"  // $r0 = 0
         "sbc %B0, r0"   "\n\t"  // rv[h] -= 0 + $carry
         "add %A0, r1"   "\n\t"  // rv[l] += $result[h]
@@ -115,10 +103,75 @@ filter_get_sample(filter_t *f, int16_t in)
         "rol %B0"       "\n\t"  // rv[h] = (rv[h] << 1) + $carry
         "clr r1"        "\n\t"  // $r1 = 0 (avr-libc convention)
         : "+&d" (rv)
-        : "a" (b1), "a" (f->_prev_in)
+        : "a" (b1), "a" (prev_in)
     );
 
-    f->_prev_out = rv;
-    f->_prev_in = in;
     return rv;
+#else
+    // each product is truncated to 8 fractional bits and accumulated with
+    // 16 bits wraparound, like the avr assembly.
+    uint16_t rv = ((int32_t) a1 * prev_out) >> 8;
+    rv += ((int32_t) b0 * in) >> 8;
+    rv += ((int32_t) b1 * prev_in) >> 8;
+    return rv << 1;
+#endif
+}
+
+
+void
+filter_render_block(filter_t *f, int16_t *buf, uint8_t n)
+{
+    if (f == NULL || !f->_initialized) {
+        memset(buf, 0, n * sizeof(int16_t));
+        return;
+    }
+
+    int8_t a1;
+    int8_t b0;
+    int8_t b1;
+
+    int16_t cutoff = f->_cutoff + f->_cutoff_mod;
+    if (cutoff < 0)
+        cutoff = 0;
+    else if (cutoff > filter_lowpass_onepole_coefficients_len - 1)
+        cutoff = filter_lowpass_onepole_coefficients_len - 1;
+
+    switch (f->_type) {
+    case FILTER_TYPE_LOW_PASS:
+        a1 = pgm_read_byte(&filter_lowpass_onepole_coefficients[cutoff].a1);
+        b0 = pgm_read_byte(&filter_lowpass_onepole_coefficients[cutoff].b0);
+        b1 = pgm_read_byte(&filter_lowpass_onepole_coefficients[cutoff].b1);
+        break;
+
+    case FILTER_TYPE_HIGH_PASS:
+        a1 = pgm_read_byte(&filter_highpass_onepole_coefficients[cutoff].a1);
+        b0 = pgm_read_byte(&filter_highpass_onepole_coefficients[cutoff].b0);
+        b1 = pgm_read_byte(&filter_highpass_onepole_coefficients[cutoff].b1);
+        break;
+
+    case FILTER_TYPE_OFF:
+    case FILTER_TYPE__LAST:
+    default:
+        return;
+    }
+
+    int16_t prev_out = f->_prev_out;
+    int16_t prev_in = f->_prev_in;
+
+    for (uint8_t i = 0; i < n; i++) {
+        int16_t in = buf[i];
+        buf[i] = prev_out = onepole(a1, b0, b1, prev_out, in, prev_in);
+        prev_in = in;
+    }
+
+    f->_prev_out = prev_out;
+    f->_prev_in = prev_in;
+}
+
+
+int16_t
+filter_get_sample(filter_t *f, int16_t in)
+{
+    filter_render_block(f, &in, 1);
+    return in;
 }
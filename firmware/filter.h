@@ -22,6 +22,7 @@ typedef struct {
     bool _initialized;
     filter_type_t _type;
     uint8_t _cutoff;
+    int8_t _cutoff_mod;
     int16_t _prev_out;
     int16_t _prev_in;
 } filter_t;
@@ -29,4 +30,6 @@ typedef struct {
 void filter_init(filter_t *f);
 bool filter_set_type(filter_t *f, filter_type_t t);
 bool filter_set_cutoff(filter_t *f, uint8_t cutoff);
+void filter_set_cutoff_mod(filter_t *f, int8_t mod);
 int16_t filter_get_sample(filter_t *f, int16_t in);
+void filter_render_block(filter_t *f, int16_t *buf, uint8_t n);
@@ -0,0 +1,150 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <avr/pgmspace.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "lfo.h"
+#include "oscillator.h"
+#include "main-data.h"
+
+// phase step per sample for the first 16 rates, as 0.32 fixed point. each
+// group of 16 rates doubles the frequency, from 0.1 Hz to 24.5 Hz:
+// round(0.1 * 2 ^ (i / 16) * 2 ^ 32 / 48000)
+static_assert(sample_rate == 48000, "lfo rates must match the sample rate");
+static const uint16_t rate_steps[16] PROGMEM = {
+    0x22f4, 0x2480, 0x261e, 0x27ce, 0x2991, 0x2b68, 0x2d54, 0x2f56,
+    0x316e, 0x339e, 0x35e7, 0x384a, 0x3ac8, 0x3d63, 0x401a, 0x42f1,
+};
+
+
+void
+lfo_init(lfo_t *l)
+{
+    if (l == NULL || l->_initialized)
+        return;
+
+    l->_initialized = true;
+    l->_waveform = LFO_WAVEFORM_SINE;
+    l->_destination = LFO_DESTINATION_PITCH;
+    l->_rate = 0;
+    l->_depth = 0;
+    l->_phase = 0;
+    l->_step = pgm_read_word(&rate_steps[0]);
+    l->_random = 0xace1;
+    l->_held = 0;
+}
+
+
+bool
+lfo_set_waveform(lfo_t *l, lfo_waveform_t wf)
+{
+    if (l != NULL && l->_initialized && l->_waveform != wf && wf < LFO_WAVEFORM__LAST) {
+        l->_waveform = wf;
+        return true;
+    }
+    return false;
+}
+
+
+bool
+lfo_set_destination(lfo_t *l, lfo_destination_t d)
+{
+    if (l != NULL && l->_initialized && l->_destination != d && d < LFO_DESTINATION__LAST) {
+        l->_destination = d;
+        return true;
+    }
+    return false;
+}
+
+
+bool
+lfo_set_rate(lfo_t *l, uint8_t rate)
+{
+    if (l != NULL && l->_initialized && l->_rate != rate && rate < 0x80) {
+        l->_rate = rate;
+        l->_step = (uint32_t) pgm_read_word(&rate_steps[rate & 0xf]) << (rate >> 4);
+        return true;
+    }
+    return false;
+}
+
+
+bool
+lfo_set_depth(lfo_t *l, uint8_t depth)
+{
+    if (l != NULL && l->_initialized && l->_depth != depth && depth < 0x80) {
+        l->_depth = depth;
+        return true;
+    }
+    return false;
+}
+
+
+lfo_destination_t
+lfo_get_destination(lfo_t *l)
+{
+    if (l == NULL || !l->_initialized)
+        return LFO_DESTINATION_PITCH;
+    return l->_destination;
+}
+
+
+uint8_t
+lfo_get_depth(lfo_t *l)
+{
+    if (l == NULL || !l->_initialized)
+        return 0;
+    return l->_depth;
+}
+
+
+int16_t
+lfo_render(lfo_t *l, uint8_t n)
+{
+    // advances the lfo by n samples, and returns its value scaled by the
+    // depth, in the range of the oscillator samples.
+
+    if (l == NULL || !l->_initialized || l->_depth == 0)
+        return 0;
+
+    uint32_t prev = l->_phase;
+    l->_phase += l->_step * n;
+    uint16_t t = l->_phase >> 16;
+
+    int16_t v;
+    switch (l->_waveform) {
+    case LFO_WAVEFORM_TRIANGLE:
+        v = t < 0x4000 ? t : (t < 0xc000 ? 0x8000 - t : t - 0x10000);
+        v >>= 5;
+        break;
+
+    case LFO_WAVEFORM_SQUARE:
+        v = t < 0x8000 ? 0x1ff : -0x1ff;
+        break;
+
+    case LFO_WAVEFORM_SAMPLE_HOLD:
+        if (l->_phase < prev) {  // new cycle
+            // galois lfsr, with the taps of a maximal length 16 bits sequence
+            for (uint8_t i = 0; i < 10; i++)
+                l->_random = (l->_random >> 1) ^ (-(l->_random & 1) & 0xb400);
+            l->_held = (int16_t) (l->_random & 0x3ff) - 0x200;
+        }
+        v = l->_held;
+        break;
+
+    case LFO_WAVEFORM_SINE:
+    default:
+        v = oscillator_get_sine(t);
+        break;
+    }
+
+    return ((int32_t) v * l->_depth) >> 7;
+}
@@ -0,0 +1,51 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// the lfo runs once per block, and its output is applied to the whole block.
+
+typedef enum {
+    LFO_WAVEFORM_SINE,
+    LFO_WAVEFORM_TRIANGLE,
+    LFO_WAVEFORM_SQUARE,
+    LFO_WAVEFORM_SAMPLE_HOLD,
+    LFO_WAVEFORM__LAST,
+} lfo_waveform_t;
+
+typedef enum {
+    LFO_DESTINATION_PITCH,
+    LFO_DESTINATION_FILTER,
+    LFO_DESTINATION_AMPLITUDE,
+    LFO_DESTINATION_PULSE_WIDTH,
+    LFO_DESTINATION__LAST,
+} lfo_destination_t;
+
+typedef struct {
+    bool _initialized;
+    lfo_waveform_t _waveform;
+    lfo_destination_t _destination;
+    uint8_t _rate;
+    uint8_t _depth;
+    uint32_t _phase;
+    uint32_t _step;
+    uint16_t _random;
+    int16_t _held;
+} lfo_t;
+
+void lfo_init(lfo_t *l);
+bool lfo_set_waveform(lfo_t *l, lfo_waveform_t wf);
+bool lfo_set_destination(lfo_t *l, lfo_destination_t d);
+bool lfo_set_rate(lfo_t *l, uint8_t rate);
+bool lfo_set_depth(lfo_t *l, uint8_t depth);
+lfo_destination_t lfo_get_destination(lfo_t *l);
+uint8_t lfo_get_depth(lfo_t *l);
+int16_t lfo_render(lfo_t *l, uint8_t n);
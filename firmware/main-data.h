@@ -10,5 +10,6 @@
 #define cpu_frqsel CLKCTRL_FRQSEL_24M_gc
 #define opamp_timebase 23
 #define output_offset 0x01ff
+#define sample_rate 48000
 #define timer_tcb_ccmp 500
 #define timer_tcb_clksel TCB_CLKSEL_DIV1_gc
@@ -6,16 +6,19 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <avr/interrupt.h>
 #include <avr/io.h>
 #include <avr/pgmspace.h>
 #include <stdlib.h>
-#include "adsr.h"
-#include "amplifier.h"
-#include "filter.h"
 #include "midi.h"
-#include "oscillator.h"
+#include "profiler.h"
+#include "scheduler.h"
 #include "screen.h"
 #include "settings.h"
+#include "synth.h"
+#if OSCILLATOR_USER_WAVETABLES
+#include "wavetable.h"
+#endif
 #include "main-data.h"
 
 FUSES =
@@ -25,24 +28,58 @@ FUSES =
     .OSCCFG = CLKSEL_OSCHF_gc,
     .SYSCFG0 = CRCSRC_NOCRC_gc | CRCSEL_CRC16_gc | RSTPINCFG_RST_gc | FUSE_EESAVE_bm,
     .SYSCFG1 = MVSYSCFG_SINGLE_gc | SUT_0MS_gc,
+#if OSCILLATOR_USER_WAVETABLES
+    // the firmware is the boot section, and the user wavetables are the
+    // application data section, that the boot section can write.
+    .CODESIZE = wavetable_flash_start / 512,
+    .BOOTSIZE = wavetable_flash_start / 512,
+#else
     .CODESIZE = 0,
     .BOOTSIZE = 0,
+#endif
 };
 
-static adsr_t adsr;
-static filter_t filter;
 static midi_t midi;
-static oscillator_t oscillator;
+static profiler_t profiler;
+static scheduler_t scheduler;
 static screen_t screen;
 static settings_t settings;
-static uint8_t note;
-static uint8_t velocity;
+static synth_t synth;
+#if OSCILLATOR_USER_WAVETABLES
+static wavetable_t wavetable;
+static uint8_t wavetable_reply_buf[wavetable_reply_len];
+#endif
+
+// samples are rendered ahead of time by the main loop, in blocks, and consumed
+// by the timer interrupt, that just writes them to the dac. must be a power of 2.
+#define audio_ring_len 32
+
+static volatile uint16_t audio_ring[audio_ring_len];
+static volatile uint8_t audio_ring_head;
+static volatile uint8_t audio_ring_tail;
+static volatile uint8_t audio_ring_underruns;
+
+#ifdef WITH_PROFILER
+static uint8_t profiler_sysex_buf[profiler_sysex_len];
+static uint16_t profiler_refresh;
+#endif
 
 static const settings_data_t factory_settings PROGMEM = {
     .version = SETTINGS_VERSION,
     .midi_channel = 0,
+    .note_priority = SYNTH_NOTE_PRIORITY_LAST,
+    .legato = 0,
     .oscillator = {
         .waveform = OSCILLATOR_WAVEFORM_SQUARE,
+        .portamento = 0,
+        .portamento_time = 0x40,
+        .pulse_width = 0x40,
+        .sub_level = 0,
+        .sub_octave = OSCILLATOR_SUB_OCTAVE_ONE,
+        .fm_ratio = 1,
+        .fm_index = 0x20,
+        .fm_envelope = 0,
+        .sync_interval = 0,
     },
     .adsr = {
         .type = ADSR_TYPE_EXPONENTIAL,
@@ -55,6 +92,12 @@ static const settings_data_t factory_settings PROGMEM = {
         .type = FILTER_TYPE_LOW_PASS,
         .cutoff = 0x3f,
     },
+    .lfo = {
+        .waveform = LFO_WAVEFORM_SINE,
+        .rate = 0x40,
+        .depth = 0,
+        .destination = LFO_DESTINATION_PITCH,
+    },
 };
 
 
@@ -107,132 +150,288 @@ dac_init(void)
 }
 
 
-static inline void
-midi_channel_cb(midi_command_t cmd, uint8_t ch, uint8_t *buf, uint8_t len)
+static void
+synth_param_cb(synth_param_t p, uint8_t v, bool changed)
 {
-    if (ch != settings.data.midi_channel && !(cmd == MIDI_CONTROL_CHANGE && buf[0] == 0x66))
-        return;
+    switch (p) {
+    case SYNTH_PARAM_OSCILLATOR_WAVEFORM:
+        settings.data.oscillator.waveform = v;
+        settings.pending.oscillator.waveform = true;
+        if (changed)
+            screen_set_oscillator_waveform(&screen, v);
+        break;
 
-    switch (cmd) {
-    case MIDI_NOTE_ON:
-        if (len == 2 && buf[0] != 0) {
-            oscillator_set_note(&oscillator, buf[0]);
-            note = buf[0];
-            velocity = buf[1] * 2;
-            adsr_set_gate(&adsr);
-            break;
-        }
+    case SYNTH_PARAM_ADSR_TYPE:
+        settings.data.adsr.type = v;
+        settings.pending.adsr.type = true;
+        if (changed)
+            screen_set_adsr_type(&screen, v);
+        break;
 
-    // fall through
-    case MIDI_NOTE_OFF:
-        if (buf[0] == note)
-            adsr_unset_gate(&adsr, false);
+    case SYNTH_PARAM_ADSR_ATTACK:
+        settings.data.adsr.attack = v;
+        settings.pending.adsr.attack = true;
+        if (changed)
+            screen_set_adsr_attack(&screen, v);
         break;
 
-    case MIDI_CONTROL_CHANGE:
-        if (len != 2)
-            break;
+    case SYNTH_PARAM_ADSR_DECAY:
+        settings.data.adsr.decay = v;
+        settings.pending.adsr.decay = true;
+        if (changed)
+            screen_set_adsr_decay(&screen, v);
+        break;
+
+    case SYNTH_PARAM_ADSR_SUSTAIN:
+        settings.data.adsr.sustain = v;
+        settings.pending.adsr.sustain = true;
+        if (changed)
+            screen_set_adsr_sustain(&screen, v);
+        break;
+
+    case SYNTH_PARAM_ADSR_RELEASE:
+        settings.data.adsr.release = v;
+        settings.pending.adsr.release = true;
+        if (changed)
+            screen_set_adsr_release(&screen, v);
+        break;
+
+    case SYNTH_PARAM_FILTER_TYPE:
+        settings.data.filter.type = v;
+        settings.pending.filter.type = true;
+        if (changed)
+            screen_set_filter_type(&screen, v);
+        break;
+
+    case SYNTH_PARAM_FILTER_CUTOFF:
+        settings.data.filter.cutoff = v;
+        settings.pending.filter.cutoff = true;
+        if (changed)
+            screen_set_filter_cutoff(&screen, v);
+        break;
+
+    // the lfo and the other oscillator parameters are not shown on the
+    // screen, there is no room left.
+    case SYNTH_PARAM_LFO_WAVEFORM:
+        settings.data.lfo.waveform = v;
+        settings.pending.lfo.waveform = true;
+        break;
+
+    case SYNTH_PARAM_LFO_RATE:
+        settings.data.lfo.rate = v;
+        settings.pending.lfo.rate = true;
+        break;
+
+    case SYNTH_PARAM_LFO_DEPTH:
+        settings.data.lfo.depth = v;
+        settings.pending.lfo.depth = true;
+        break;
+
+    case SYNTH_PARAM_LFO_DESTINATION:
+        settings.data.lfo.destination = v;
+        settings.pending.lfo.destination = true;
+        break;
+
+    case SYNTH_PARAM_PORTAMENTO:
+        settings.data.oscillator.portamento = v;
+        settings.pending.oscillator.portamento = true;
+        break;
+
+    case SYNTH_PARAM_PORTAMENTO_TIME:
+        settings.data.oscillator.portamento_time = v;
+        settings.pending.oscillator.portamento_time = true;
+        break;
+
+    case SYNTH_PARAM_PULSE_WIDTH:
+        settings.data.oscillator.pulse_width = v;
+        settings.pending.oscillator.pulse_width = true;
+        break;
+
+    case SYNTH_PARAM_SUB_LEVEL:
+        settings.data.oscillator.sub_level = v;
+        settings.pending.oscillator.sub_level = true;
+        break;
+
+    case SYNTH_PARAM_SUB_OCTAVE:
+        settings.data.oscillator.sub_octave = v;
+        settings.pending.oscillator.sub_octave = true;
+        break;
+
+    case SYNTH_PARAM_FM_RATIO:
+        settings.data.oscillator.fm_ratio = v;
+        settings.pending.oscillator.fm_ratio = true;
+        break;
+
+    case SYNTH_PARAM_FM_INDEX:
+        settings.data.oscillator.fm_index = v;
+        settings.pending.oscillator.fm_index = true;
+        break;
+
+    case SYNTH_PARAM_FM_ENVELOPE:
+        settings.data.oscillator.fm_envelope = v;
+        settings.pending.oscillator.fm_envelope = true;
+        break;
+
+    case SYNTH_PARAM_SYNC_INTERVAL:
+        settings.data.oscillator.sync_interval = v;
+        settings.pending.oscillator.sync_interval = true;
+        break;
+
+    case SYNTH_PARAM_NOTE_PRIORITY:
+        settings.data.note_priority = v;
+        settings.pending.note_priority = true;
+        break;
+
+    case SYNTH_PARAM_LEGATO:
+        settings.data.legato = v;
+        settings.pending.legato = true;
+        break;
+
+    default:
+        break;
+    }
+}
 
-        switch (buf[0]) {
-        case 3:  // waveform
-            settings.data.oscillator.waveform = buf[1] / (0x80 / OSCILLATOR_WAVEFORM__LAST);
-            if (settings.data.oscillator.waveform >= OSCILLATOR_WAVEFORM__LAST)
-                settings.data.oscillator.waveform--;
-            settings.pending.oscillator.waveform = true;
-            if (oscillator_set_waveform(&oscillator, settings.data.oscillator.waveform))
-                screen_set_oscillator_waveform(&screen, settings.data.oscillator.waveform);
-            break;
-
-        case 70:  // adsr type
-            settings.data.adsr.type = buf[1] / (0x80 / ADSR_TYPE__LAST);
-            if (settings.data.adsr.type >= ADSR_TYPE__LAST)
-                settings.data.adsr.type--;
-            settings.pending.adsr.type = true;
-            if (adsr_set_type(&adsr, settings.data.adsr.type))
-                screen_set_adsr_type(&screen, settings.data.adsr.type);
-            break;
-
-        case 71:  // filter type
-            settings.data.filter.type = buf[1] / (0x80 / FILTER_TYPE__LAST);
-            if (settings.data.filter.type >= FILTER_TYPE__LAST)
-                settings.data.filter.type--;
-            settings.pending.filter.type = true;
-            if (filter_set_type(&filter, settings.data.filter.type))
-                screen_set_filter_type(&screen, settings.data.filter.type);
-            break;
-
-        case 72:  // adsr release
-            settings.data.adsr.release = buf[1];
-            settings.pending.adsr.release = true;
-            if (adsr_set_release(&adsr, settings.data.adsr.release))
-                screen_set_adsr_release(&screen, settings.data.adsr.release);
-            break;
-
-        case 73:  // adsr attack
-            settings.data.adsr.attack = buf[1];
-            settings.pending.adsr.attack = true;
-            if (adsr_set_attack(&adsr, settings.data.adsr.attack))
-                screen_set_adsr_attack(&screen, settings.data.adsr.attack);
-            break;
-
-        case 74:  // filter cutoff
-            settings.data.filter.cutoff = buf[1];
-            settings.pending.filter.cutoff = true;
-            if (filter_set_cutoff(&filter, settings.data.filter.cutoff))
-                screen_set_filter_cutoff(&screen, settings.data.filter.cutoff);
-            break;
-
-        case 75:  // adsr decay
-            settings.data.adsr.decay = buf[1];
-            settings.pending.adsr.decay = true;
-            if (adsr_set_decay(&adsr, settings.data.adsr.decay))
-                screen_set_adsr_decay(&screen, settings.data.adsr.decay);
-            break;
-
-        case 79:  // adsr sustain
-            settings.data.adsr.sustain = buf[1];
-            settings.pending.adsr.sustain = true;
-            if (adsr_set_sustain(&adsr, settings.data.adsr.sustain))
-                screen_set_adsr_sustain(&screen, settings.data.adsr.sustain);
-            break;
 
+static inline void
+midi_channel_cb(midi_command_t cmd, uint8_t ch, uint8_t *buf, uint8_t len)
+{
+    if (ch != settings.data.midi_channel && !(cmd == MIDI_CONTROL_CHANGE && buf[0] == 0x66))
+        return;
+
+    // device controls are handled here, everything else is sound related.
+    if (cmd == MIDI_CONTROL_CHANGE && len == 2) {
+        switch (buf[0]) {
         case 102:  // midi channel
             if (buf[1] > 0x3f) {
                 settings.data.midi_channel = ch;
                 settings.pending.midi_channel = true;
                 screen_set_midi_channel(&screen, settings.data.midi_channel);
             }
-            break;
+            return;
 
         case 119:  // write settings
             if (buf[1] > 0x3f)
                 settings_start_write(&settings);
-            break;
+            return;
 
-        case 120:  // all sound off
-        case 123:  // all notes off
-            adsr_unset_gate(&adsr, true);
-            break;
-        }
-        break;
+#ifdef WITH_PROFILER
+        case 103:  // diagnostics page
+            screen_set_diagnostics(&screen, buf[1] / 43);
+            return;
 
-    default:
-        break;
+        case 104:  // send profiler data
+            if (buf[1] > 0x3f)
+                midi_send(&midi, profiler_sysex_buf, profiler_sysex(&profiler, profiler_sysex_buf, profiler_sysex_len));
+            return;
+
+        case 105:  // reset profiler data
+            if (buf[1] > 0x3f) {
+                profiler_reset(&profiler);
+                scheduler.deferred = 0;
+            }
+            return;
+#endif
+        }
     }
+
+    synth_midi_channel(&synth, cmd, buf, len);
 }
 
 
+#if OSCILLATOR_USER_WAVETABLES
+static void
+midi_system_cb(midi_system_subcommand_t cmd, uint8_t *buf, uint8_t len)
+{
+    wavetable_sysex(&wavetable, cmd, buf, len);
+}
+#endif
+
+
+static void
+midi_task_cb(void)
+{
+    midi_task(&midi);
+}
+
+
+static void
+settings_task_cb(void)
+{
+    if (settings_task(&settings))
+        screen_notification(&screen, SCREEN_NOTIFICATION_PRESET_UPDATED);
+}
+
+
+static void
+screen_task_cb(void)
+{
+    screen_task(&screen);
+}
+
+
+#if OSCILLATOR_USER_WAVETABLES
+static void
+wavetable_task_cb(void)
+{
+    // the reply is only sent after the previous message, the sender waits
+    // for it anyway.
+    if (midi_is_sending(&midi))
+        return;
+
+    uint8_t len = wavetable_task(&wavetable, synth_is_idle(&synth), wavetable_reply_buf, wavetable_reply_len);
+    if (len == 0)
+        return;
+
+    midi_send(&midi, wavetable_reply_buf, len);
+    if (wavetable_reply_buf[4] == wavetable_levels - 1 && wavetable_reply_buf[5] == WAVETABLE_STATUS_OK)
+        screen_notification(&screen, SCREEN_NOTIFICATION_WAVETABLE_UPDATED);
+}
+#endif
+
+
+// sorted by priority. costs are worst case estimates, the profiler diagnostics
+// page shows the measured values.
+static const scheduler_task_t tasks[] = {
+    {midi_task_cb, 2000, PROFILER_STAGE_MIDI},
+    {settings_task_cb, 300, PROFILER_STAGE_SETTINGS},
+    {screen_task_cb, 400, PROFILER_STAGE_SCREEN},
+#if OSCILLATOR_USER_WAVETABLES
+    {wavetable_task_cb, 300, PROFILER_STAGE_WAVETABLE},
+#endif
+};
+
+
 static inline void
 timer_init(void)
 {
     // number of cycles between each audio sample
     TCB0.CCMP = timer_tcb_ccmp;
 
+    // the interrupt only pops samples from the ring
+    TCB0.INTCTRL = TCB_CAPT_bm;
+
     // enable timer without prescaler division
     TCB0.CTRLA = TCB_RUNSTDBY_bm | timer_tcb_clksel | TCB_ENABLE_bm;
 }
 
 
+ISR(TCB0_INT_vect)
+{
+    TCB0.INTFLAGS = TCB_CAPT_bm;
+
+    // if the main loop fell behind, the dac just holds the previous sample.
+    uint8_t tail = audio_ring_tail;
+    if (tail == audio_ring_head) {
+        audio_ring_underruns++;
+        return;
+    }
+
+    DAC0.DATA = audio_ring[tail];
+    audio_ring_tail = (tail + 1) & (audio_ring_len - 1);
+}
+
+
 int
 main(void)
 {
@@ -241,57 +440,97 @@ main(void)
     dac_init();
     timer_init();
 
-    adsr_init(&adsr);
-    filter_init(&filter);
+#if OSCILLATOR_USER_WAVETABLES
+    // the interrupt vectors are in the boot section.
+    _PROTECTED_WRITE(CPUINT.CTRLA, CPUINT_IVSEL_bm);
+
+    midi_init(&midi, midi_channel_cb, midi_system_cb);
+    wavetable_init(&wavetable);
+#else
     midi_init(&midi, midi_channel_cb, NULL);
-    oscillator_init(&oscillator);
+#endif
+    profiler_init(&profiler);
     screen_init(&screen);
+    synth_init(&synth, synth_param_cb, &profiler);
+    scheduler_init(&scheduler, tasks, sizeof(tasks) / sizeof(tasks[0]), &profiler);
 
     if (settings_init(&settings, &factory_settings)) {
         screen_set_midi_channel(&screen, settings.data.midi_channel);
 
-        oscillator_set_waveform(&oscillator, settings.data.oscillator.waveform);
+        synth_set_param(&synth, SYNTH_PARAM_OSCILLATOR_WAVEFORM, settings.data.oscillator.waveform);
         screen_set_oscillator_waveform(&screen, settings.data.oscillator.waveform);
 
-        adsr_set_type(&adsr, settings.data.adsr.type);
+        synth_set_param(&synth, SYNTH_PARAM_ADSR_TYPE, settings.data.adsr.type);
         screen_set_adsr_type(&screen, settings.data.adsr.type);
 
-        adsr_set_attack(&adsr, settings.data.adsr.attack);
+        synth_set_param(&synth, SYNTH_PARAM_ADSR_ATTACK, settings.data.adsr.attack);
         screen_set_adsr_attack(&screen, settings.data.adsr.attack);
 
-        adsr_set_decay(&adsr, settings.data.adsr.decay);
+        synth_set_param(&synth, SYNTH_PARAM_ADSR_DECAY, settings.data.adsr.decay);
         screen_set_adsr_decay(&screen, settings.data.adsr.decay);
 
-        adsr_set_sustain(&adsr, settings.data.adsr.sustain);
+        synth_set_param(&synth, SYNTH_PARAM_ADSR_SUSTAIN, settings.data.adsr.sustain);
         screen_set_adsr_sustain(&screen, settings.data.adsr.sustain);
 
-        adsr_set_release(&adsr, settings.data.adsr.release);
+        synth_set_param(&synth, SYNTH_PARAM_ADSR_RELEASE, settings.data.adsr.release);
         screen_set_adsr_release(&screen, settings.data.adsr.release);
 
-        filter_set_type(&filter, settings.data.filter.type);
+        synth_set_param(&synth, SYNTH_PARAM_FILTER_TYPE, settings.data.filter.type);
         screen_set_filter_type(&screen, settings.data.filter.type);
 
-        filter_set_cutoff(&filter, settings.data.filter.cutoff);
+        synth_set_param(&synth, SYNTH_PARAM_FILTER_CUTOFF, settings.data.filter.cutoff);
         screen_set_filter_cutoff(&screen, settings.data.filter.cutoff);
+
+        synth_set_param(&synth, SYNTH_PARAM_LFO_WAVEFORM, settings.data.lfo.waveform);
+        synth_set_param(&synth, SYNTH_PARAM_LFO_RATE, settings.data.lfo.rate);
+        synth_set_param(&synth, SYNTH_PARAM_LFO_DEPTH, settings.data.lfo.depth);
+        synth_set_param(&synth, SYNTH_PARAM_LFO_DESTINATION, settings.data.lfo.destination);
+        synth_set_param(&synth, SYNTH_PARAM_PORTAMENTO, settings.data.oscillator.portamento);
+        synth_set_param(&synth, SYNTH_PARAM_PORTAMENTO_TIME, settings.data.oscillator.portamento_time);
+        synth_set_param(&synth, SYNTH_PARAM_PULSE_WIDTH, settings.data.oscillator.pulse_width);
+        synth_set_param(&synth, SYNTH_PARAM_SUB_LEVEL, settings.data.oscillator.sub_level);
+        synth_set_param(&synth, SYNTH_PARAM_SUB_OCTAVE, settings.data.oscillator.sub_octave);
+        synth_set_param(&synth, SYNTH_PARAM_FM_RATIO, settings.data.oscillator.fm_ratio);
+        synth_set_param(&synth, SYNTH_PARAM_FM_INDEX, settings.data.oscillator.fm_index);
+        synth_set_param(&synth, SYNTH_PARAM_FM_ENVELOPE, settings.data.oscillator.fm_envelope);
+        synth_set_param(&synth, SYNTH_PARAM_SYNC_INTERVAL, settings.data.oscillator.sync_interval);
+        synth_set_param(&synth, SYNTH_PARAM_NOTE_PRIORITY, settings.data.note_priority);
+        synth_set_param(&synth, SYNTH_PARAM_LEGATO, settings.data.legato);
     }
 
+    sei();
+
     while (1) {
-        if (TCB0.INTFLAGS & TCB_CAPT_bm) {
-            TCB0.INTFLAGS = TCB_CAPT_bm;
-
-            midi_task(&midi);
-            screen_task(&screen);
-            if (settings_task(&settings))
-                screen_notification(&screen, SCREEN_NOTIFICATION_PRESET_UPDATED);
-
-            int16_t dac_val = filter_get_sample(&filter, amplifier_get_sample(oscillator_get_sample(&oscillator),
-                adsr_get_sample_level(&adsr), velocity)) + output_offset;
-            if (dac_val < 0)
-                dac_val = 0;
-            else if (dac_val > (output_offset << 1))
-                dac_val = output_offset << 1;
-            DAC0.DATA = dac_val << DAC_DATA_0_bp;
+        uint8_t head = audio_ring_head;
+        uint8_t queued = (head - audio_ring_tail) & (audio_ring_len - 1);
+
+        // background tasks can use the time until the ring buffer has room
+        // for the next block, so they never delay the audio path, and the
+        // whole ring buffer is left as margin for the block render.
+        if (queued >= audio_ring_len - synth_block_len) {
+            scheduler_run(&scheduler, (uint16_t) (queued - (audio_ring_len - synth_block_len - 1)) * timer_tcb_ccmp);
+            continue;
+        }
+
+        profiler_start(&profiler);
+
+        uint16_t block[synth_block_len];
+        synth_render_block(&synth, block, synth_block_len);
+
+        for (uint8_t i = 0; i < synth_block_len; i++) {
+            audio_ring[head] = block[i] << DAC_DATA_0_bp;
+            head = (head + 1) & (audio_ring_len - 1);
         }
+        audio_ring_head = head;
+        profiler_stage(&profiler, PROFILER_STAGE_DAC);
+        profiler_underruns(&profiler, audio_ring_underruns);
+        screen_tick(&screen, synth_block_len);
+
+#ifdef WITH_PROFILER
+        // refresh the diagnostics page every 2048 blocks (~340ms)
+        if ((++profiler_refresh & 0x7ff) == 0)
+            screen_set_profiler(&screen, &profiler, scheduler.deferred);
+#endif
     }
 
     return 0;
@@ -30,13 +30,18 @@ midi_init(midi_t *m, midi_channel_cb_t ch, midi_system_cb_t sys)
     m->_channel_cb = ch;
     m->_system_cb = sys;
     m->_state = MIDI_STATE_WAITING;
+    m->_sysex = false;
+    m->_tx_len = 0;
+    m->_tx_started = false;
     m->_initialized = true;
 }
 
 
 static bool
-handle_byte(uint8_t *data)
+handle_byte(midi_t *m, uint8_t *data)
 {
+    // the state of the midi_t pointer is checked by the caller.
+
     // nothing to read from usart, return
     if (!(USART1.STATUS & USART_RXCIF_bm))
         return false;
@@ -44,8 +49,9 @@ handle_byte(uint8_t *data)
     *data = USART1.RXDATAL;
 
     // we don't need any additional buffering because data
-    // is consumed and feed at same rate.
-    if (USART1.STATUS & USART_DREIF_bm)
+    // is consumed and feed at same rate. thru is suspended while
+    // sending our own messages.
+    if (!m->_tx_started && (USART1.STATUS & USART_DREIF_bm))
         USART1.TXDATAL = *data;
 
     return true;
@@ -58,16 +64,33 @@ midi_task(midi_t *m)
     if (m == NULL || !m->_initialized)
         return;
 
+    // our own messages are only started between complete incoming messages,
+    // to not break the thru stream. sysex data bytes return to the waiting
+    // state too, so a sysex must be finished as well.
+    if (m->_tx_len != 0 && (m->_tx_started || (m->_state == MIDI_STATE_WAITING && !m->_sysex)) && (USART1.STATUS & USART_DREIF_bm)) {
+        USART1.TXDATAL = *m->_tx_buf++;
+        m->_tx_started = --m->_tx_len != 0;
+    }
+
     uint8_t prev;
 
     switch (m->_state) {
     case MIDI_STATE_WAITING:
         prev = m->_buf[0];
-        if (handle_byte(&(m->_buf[0]))) {
+        if (handle_byte(m, &(m->_buf[0]))) {
             if (m->_buf[0] >= 0x80) {  // status
+                // real time messages can be sent in the middle of a sysex.
+                if (m->_buf[0] < 0xf8)
+                    m->_sysex = m->_buf[0] == 0xf0;
                 m->_state = MIDI_STATE_STATUS;
             }
-            else if (prev >= 0x80) {  // running status
+            else if (m->_sysex) {  // sysex data
+                m->_state = MIDI_STATE_CALLBACK;
+                m->_len = 1;
+                m->_buf[1] = m->_buf[0];
+                m->_buf[0] = 0xf0;
+            }
+            else if (prev >= 0x80 && prev < 0xf0) {  // running status
                 m->_state = m->_len == 1 ? MIDI_STATE_CALLBACK : MIDI_STATE_DATA2;
                 m->_buf[1] = m->_buf[0];
                 m->_buf[0] = prev;
@@ -126,7 +149,7 @@ midi_task(midi_t *m)
         break;
 
     case MIDI_STATE_DATA1:
-        if (handle_byte(&(m->_buf[1]))) {
+        if (handle_byte(m, &(m->_buf[1]))) {
             if (m->_buf[1] >= 0x80) {  // status
                 m->_buf[0] = m->_buf[1];
                 m->_state = MIDI_STATE_STATUS;
@@ -137,7 +160,7 @@ midi_task(midi_t *m)
         break;
 
     case MIDI_STATE_DATA2:
-        if (handle_byte(&(m->_buf[2]))) {
+        if (handle_byte(m, &(m->_buf[2]))) {
             if (m->_buf[2] >= 0x80) {  // status
                 m->_buf[0] = m->_buf[2];
                 m->_state = MIDI_STATE_STATUS;
@@ -161,3 +184,23 @@ midi_task(midi_t *m)
         m->_state = MIDI_STATE_WAITING;
     }
 }
+
+
+bool
+midi_send(midi_t *m, const uint8_t *buf, uint8_t len)
+{
+    if (m == NULL || !m->_initialized || buf == NULL || len == 0 || m->_tx_len != 0)
+        return false;
+
+    // buffer must be kept valid until the message is sent.
+    m->_tx_buf = buf;
+    m->_tx_len = len;
+    return true;
+}
+
+
+bool
+midi_is_sending(midi_t *m)
+{
+    return m != NULL && m->_initialized && m->_tx_len != 0;
+}
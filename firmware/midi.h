@@ -42,6 +42,9 @@ typedef enum {
     MIDI_SYSTEM_RT_SYSTEM_RESET,
 } midi_system_subcommand_t;
 
+// system exclusive messages are reported as MIDI_SYSTEM_SYSEX1 without data
+// when started, then once for each data byte, and as MIDI_SYSTEM_SYSEX2 when
+// finished.
 typedef void (*midi_channel_cb_t)(midi_command_t cmd, uint8_t ch, uint8_t *buf, uint8_t len);
 typedef void (*midi_system_cb_t)(midi_system_subcommand_t cmd, uint8_t *buf, uint8_t len);
 
@@ -49,8 +52,12 @@ typedef struct {
     bool _initialized;
     uint8_t _buf[3];
     uint8_t _len;
+    bool _sysex;
     midi_channel_cb_t _channel_cb;
     midi_system_cb_t _system_cb;
+    const uint8_t *_tx_buf;
+    uint8_t _tx_len;
+    bool _tx_started;
 
     enum {
         MIDI_STATE_WAITING,
@@ -63,3 +70,5 @@ typedef struct {
 
 void midi_init(midi_t *m, midi_channel_cb_t ch, midi_system_cb_t sys);
 void midi_task(midi_t *m);
+bool midi_send(midi_t *m, const uint8_t *buf, uint8_t len);
+bool midi_is_sending(midi_t *m);
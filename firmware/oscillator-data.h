@@ -8,7 +8,7 @@
 #include <avr/pgmspace.h>
 #include <stdint.h>
 
-static const int16_t oscillator_sine[512] PROGMEM = {
+static const int16_t oscillator_sine[129] oscillator_wavetable_attr = {
     0x0000, 0x0006, 0x000c, 0x0012, 0x0019, 0x001f, 0x0025, 0x002b, 0x0032, 0x0038, 0x003e, 0x0044,
     0x004a, 0x0051, 0x0057, 0x005d, 0x0063, 0x0069, 0x006f, 0x0076, 0x007c, 0x0082, 0x0088, 0x008e,
     0x0094, 0x009a, 0x00a0, 0x00a6, 0x00ac, 0x00b2, 0x00b7, 0x00bd, 0x00c3, 0x00c9, 0x00cf, 0x00d4,
@@ -19,43 +19,11 @@ static const int16_t oscillator_sine[512] PROGMEM = {
     0x01b6, 0x01b9, 0x01bc, 0x01bf, 0x01c2, 0x01c5, 0x01c8, 0x01cb, 0x01cd, 0x01d0, 0x01d3, 0x01d5,
     0x01d8, 0x01da, 0x01dc, 0x01de, 0x01e1, 0x01e3, 0x01e5, 0x01e7, 0x01e8, 0x01ea, 0x01ec, 0x01ee,
     0x01ef, 0x01f1, 0x01f2, 0x01f3, 0x01f5, 0x01f6, 0x01f7, 0x01f8, 0x01f9, 0x01fa, 0x01fb, 0x01fb,
-    0x01fc, 0x01fd, 0x01fd, 0x01fe, 0x01fe, 0x01fe, 0x01fe, 0x01fe, 0x01ff, 0x01fe, 0x01fe, 0x01fe,
-    0x01fe, 0x01fe, 0x01fd, 0x01fd, 0x01fc, 0x01fb, 0x01fb, 0x01fa, 0x01f9, 0x01f8, 0x01f7, 0x01f6,
-    0x01f5, 0x01f3, 0x01f2, 0x01f1, 0x01ef, 0x01ee, 0x01ec, 0x01ea, 0x01e8, 0x01e7, 0x01e5, 0x01e3,
-    0x01e1, 0x01de, 0x01dc, 0x01da, 0x01d8, 0x01d5, 0x01d3, 0x01d0, 0x01cd, 0x01cb, 0x01c8, 0x01c5,
-    0x01c2, 0x01bf, 0x01bc, 0x01b9, 0x01b6, 0x01b3, 0x01af, 0x01ac, 0x01a8, 0x01a5, 0x01a1, 0x019e,
-    0x019a, 0x0196, 0x0192, 0x018e, 0x018b, 0x0187, 0x0182, 0x017e, 0x017a, 0x0176, 0x0172, 0x016d,
-    0x0169, 0x0164, 0x0160, 0x015b, 0x0157, 0x0152, 0x014d, 0x0148, 0x0144, 0x013f, 0x013a, 0x0135,
-    0x0130, 0x012b, 0x0126, 0x0121, 0x011b, 0x0116, 0x0111, 0x010c, 0x0106, 0x0101, 0x00fb, 0x00f6,
-    0x00f0, 0x00eb, 0x00e5, 0x00e0, 0x00da, 0x00d4, 0x00cf, 0x00c9, 0x00c3, 0x00bd, 0x00b7, 0x00b2,
-    0x00ac, 0x00a6, 0x00a0, 0x009a, 0x0094, 0x008e, 0x0088, 0x0082, 0x007c, 0x0076, 0x006f, 0x0069,
-    0x0063, 0x005d, 0x0057, 0x0051, 0x004a, 0x0044, 0x003e, 0x0038, 0x0032, 0x002b, 0x0025, 0x001f,
-    0x0019, 0x0012, 0x000c, 0x0006, 0x0000, 0xfffa, 0xfff4, 0xffee, 0xffe7, 0xffe1, 0xffdb, 0xffd5,
-    0xffce, 0xffc8, 0xffc2, 0xffbc, 0xffb6, 0xffaf, 0xffa9, 0xffa3, 0xff9d, 0xff97, 0xff91, 0xff8a,
-    0xff84, 0xff7e, 0xff78, 0xff72, 0xff6c, 0xff66, 0xff60, 0xff5a, 0xff54, 0xff4e, 0xff49, 0xff43,
-    0xff3d, 0xff37, 0xff31, 0xff2c, 0xff26, 0xff20, 0xff1b, 0xff15, 0xff10, 0xff0a, 0xff05, 0xfeff,
-    0xfefa, 0xfef4, 0xfeef, 0xfeea, 0xfee5, 0xfedf, 0xfeda, 0xfed5, 0xfed0, 0xfecb, 0xfec6, 0xfec1,
-    0xfebc, 0xfeb8, 0xfeb3, 0xfeae, 0xfea9, 0xfea5, 0xfea0, 0xfe9c, 0xfe97, 0xfe93, 0xfe8e, 0xfe8a,
-    0xfe86, 0xfe82, 0xfe7e, 0xfe79, 0xfe75, 0xfe72, 0xfe6e, 0xfe6a, 0xfe66, 0xfe62, 0xfe5f, 0xfe5b,
-    0xfe58, 0xfe54, 0xfe51, 0xfe4d, 0xfe4a, 0xfe47, 0xfe44, 0xfe41, 0xfe3e, 0xfe3b, 0xfe38, 0xfe35,
-    0xfe33, 0xfe30, 0xfe2d, 0xfe2b, 0xfe28, 0xfe26, 0xfe24, 0xfe22, 0xfe1f, 0xfe1d, 0xfe1b, 0xfe19,
-    0xfe18, 0xfe16, 0xfe14, 0xfe12, 0xfe11, 0xfe0f, 0xfe0e, 0xfe0d, 0xfe0b, 0xfe0a, 0xfe09, 0xfe08,
-    0xfe07, 0xfe06, 0xfe05, 0xfe05, 0xfe04, 0xfe03, 0xfe03, 0xfe02, 0xfe02, 0xfe02, 0xfe02, 0xfe02,
-    0xfe01, 0xfe02, 0xfe02, 0xfe02, 0xfe02, 0xfe02, 0xfe03, 0xfe03, 0xfe04, 0xfe05, 0xfe05, 0xfe06,
-    0xfe07, 0xfe08, 0xfe09, 0xfe0a, 0xfe0b, 0xfe0d, 0xfe0e, 0xfe0f, 0xfe11, 0xfe12, 0xfe14, 0xfe16,
-    0xfe18, 0xfe19, 0xfe1b, 0xfe1d, 0xfe1f, 0xfe22, 0xfe24, 0xfe26, 0xfe28, 0xfe2b, 0xfe2d, 0xfe30,
-    0xfe33, 0xfe35, 0xfe38, 0xfe3b, 0xfe3e, 0xfe41, 0xfe44, 0xfe47, 0xfe4a, 0xfe4d, 0xfe51, 0xfe54,
-    0xfe58, 0xfe5b, 0xfe5f, 0xfe62, 0xfe66, 0xfe6a, 0xfe6e, 0xfe72, 0xfe75, 0xfe79, 0xfe7e, 0xfe82,
-    0xfe86, 0xfe8a, 0xfe8e, 0xfe93, 0xfe97, 0xfe9c, 0xfea0, 0xfea5, 0xfea9, 0xfeae, 0xfeb3, 0xfeb8,
-    0xfebc, 0xfec1, 0xfec6, 0xfecb, 0xfed0, 0xfed5, 0xfeda, 0xfedf, 0xfee5, 0xfeea, 0xfeef, 0xfef4,
-    0xfefa, 0xfeff, 0xff05, 0xff0a, 0xff10, 0xff15, 0xff1b, 0xff20, 0xff26, 0xff2c, 0xff31, 0xff37,
-    0xff3d, 0xff43, 0xff49, 0xff4e, 0xff54, 0xff5a, 0xff60, 0xff66, 0xff6c, 0xff72, 0xff78, 0xff7e,
-    0xff84, 0xff8a, 0xff91, 0xff97, 0xff9d, 0xffa3, 0xffa9, 0xffaf, 0xffb6, 0xffbc, 0xffc2, 0xffc8,
-    0xffce, 0xffd5, 0xffdb, 0xffe1, 0xffe7, 0xffee, 0xfff4, 0xfffa,
+    0x01fc, 0x01fd, 0x01fd, 0x01fe, 0x01fe, 0x01fe, 0x01fe, 0x01fe, 0x01ff,
 };
-#define oscillator_sine_len 512
+#define oscillator_sine_len 129
 
-static const int16_t oscillator_blsquare[10][512] PROGMEM = {
+static const int16_t oscillator_blsquare[10][128] oscillator_wavetable_attr = {
     {
         0x01d0, 0x01f0, 0x01ff, 0x01fd, 0x01f5, 0x01f0, 0x01f1, 0x01f6, 0x01f9, 0x01f8, 0x01f4,
         0x01f2, 0x01f3, 0x01f6, 0x01f7, 0x01f6, 0x01f4, 0x01f3, 0x01f4, 0x01f6, 0x01f7, 0x01f6,
@@ -68,42 +36,7 @@ static const int16_t oscillator_blsquare[10][512] PROGMEM = {
         0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5,
         0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5,
         0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5,
-        0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5,
-        0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5,
-        0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5,
-        0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5,
-        0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f6, 0x01f5, 0x01f5, 0x01f5, 0x01f5,
-        0x01f5, 0x01f6, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f6, 0x01f5, 0x01f5, 0x01f5,
-        0x01f5, 0x01f5, 0x01f6, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f6, 0x01f6, 0x01f5, 0x01f4,
-        0x01f5, 0x01f5, 0x01f6, 0x01f5, 0x01f5, 0x01f4, 0x01f5, 0x01f5, 0x01f6, 0x01f5, 0x01f5,
-        0x01f4, 0x01f5, 0x01f6, 0x01f6, 0x01f5, 0x01f4, 0x01f4, 0x01f5, 0x01f6, 0x01f6, 0x01f5,
-        0x01f4, 0x01f4, 0x01f5, 0x01f6, 0x01f6, 0x01f5, 0x01f4, 0x01f4, 0x01f5, 0x01f6, 0x01f6,
-        0x01f5, 0x01f4, 0x01f4, 0x01f6, 0x01f7, 0x01f6, 0x01f4, 0x01f3, 0x01f4, 0x01f6, 0x01f7,
-        0x01f6, 0x01f3, 0x01f2, 0x01f4, 0x01f8, 0x01f9, 0x01f6, 0x01f1, 0x01f0, 0x01f5, 0x01fd,
-        0x01ff, 0x01f0, 0x01d0, 0xfe30, 0xfe10, 0xfe01, 0xfe03, 0xfe0b, 0xfe10, 0xfe0f, 0xfe0a,
-        0xfe07, 0xfe08, 0xfe0c, 0xfe0e, 0xfe0d, 0xfe0a, 0xfe09, 0xfe0a, 0xfe0c, 0xfe0d, 0xfe0c,
-        0xfe0a, 0xfe09, 0xfe0a, 0xfe0c, 0xfe0c, 0xfe0b, 0xfe0a, 0xfe0a, 0xfe0b, 0xfe0c, 0xfe0c,
-        0xfe0b, 0xfe0a, 0xfe0a, 0xfe0b, 0xfe0c, 0xfe0c, 0xfe0b, 0xfe0a, 0xfe0a, 0xfe0b, 0xfe0c,
-        0xfe0c, 0xfe0b, 0xfe0a, 0xfe0a, 0xfe0b, 0xfe0c, 0xfe0b, 0xfe0b, 0xfe0a, 0xfe0b, 0xfe0b,
-        0xfe0c, 0xfe0b, 0xfe0b, 0xfe0a, 0xfe0b, 0xfe0b, 0xfe0c, 0xfe0b, 0xfe0a, 0xfe0a, 0xfe0b,
-        0xfe0b, 0xfe0b, 0xfe0b, 0xfe0a, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0a, 0xfe0b,
-        0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0a, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0a,
-        0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b,
-        0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b,
-        0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b,
-        0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b,
-        0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b,
-        0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b,
-        0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b,
-        0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0a, 0xfe0b,
-        0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0a, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0a,
-        0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0a, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0b, 0xfe0a,
-        0xfe0a, 0xfe0b, 0xfe0c, 0xfe0b, 0xfe0b, 0xfe0a, 0xfe0b, 0xfe0b, 0xfe0c, 0xfe0b, 0xfe0b,
-        0xfe0a, 0xfe0b, 0xfe0b, 0xfe0c, 0xfe0b, 0xfe0a, 0xfe0a, 0xfe0b, 0xfe0c, 0xfe0c, 0xfe0b,
-        0xfe0a, 0xfe0a, 0xfe0b, 0xfe0c, 0xfe0c, 0xfe0b, 0xfe0a, 0xfe0a, 0xfe0b, 0xfe0c, 0xfe0c,
-        0xfe0b, 0xfe0a, 0xfe0a, 0xfe0b, 0xfe0c, 0xfe0c, 0xfe0a, 0xfe09, 0xfe0a, 0xfe0c, 0xfe0d,
-        0xfe0c, 0xfe0a, 0xfe09, 0xfe0a, 0xfe0d, 0xfe0e, 0xfe0c, 0xfe08, 0xfe07, 0xfe0a, 0xfe0f,
-        0xfe10, 0xfe0b, 0xfe03, 0xfe01, 0xfe10, 0xfe30,
+        0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5, 0x01f5,
     },
     {
         0x019b, 0x01bb, 0x01d7, 0x01ec, 0x01f9, 0x01ff, 0x01fd, 0x01f8, 0x01f1, 0x01ea, 0x01e5,
@@ -117,42 +50,7 @@ static const int16_t oscillator_blsquare[10][512] PROGMEM = {
         0x01ee, 0x01ed, 0x01ed, 0x01ec, 0x01eb, 0x01eb, 0x01ec, 0x01ec, 0x01ed, 0x01ee, 0x01ee,
         0x01ee, 0x01ee, 0x01ed, 0x01ec, 0x01ec, 0x01eb, 0x01eb, 0x01ec, 0x01ed, 0x01ee, 0x01ee,
         0x01ee, 0x01ee, 0x01ee, 0x01ed, 0x01ec, 0x01ec, 0x01eb, 0x01ec, 0x01ec, 0x01ed, 0x01ee,
-        0x01ee, 0x01ee, 0x01ee, 0x01ed, 0x01ed, 0x01ec, 0x01eb, 0x01eb, 0x01ec, 0x01ed, 0x01ed,
-        0x01ee, 0x01ee, 0x01ee, 0x01ee, 0x01ed, 0x01ec, 0x01ec, 0x01eb, 0x01ec, 0x01ec, 0x01ed,
-        0x01ee, 0x01ee, 0x01ee, 0x01ee, 0x01ee, 0x01ed, 0x01ec, 0x01eb, 0x01eb, 0x01ec, 0x01ec,
-        0x01ed, 0x01ee, 0x01ee, 0x01ee, 0x01ee, 0x01ed, 0x01ec, 0x01ec, 0x01eb, 0x01eb, 0x01ec,
-        0x01ed, 0x01ed, 0x01ee, 0x01ee, 0x01ee, 0x01ee, 0x01ed, 0x01ec, 0x01eb, 0x01eb, 0x01eb,
-        0x01ec, 0x01ed, 0x01ee, 0x01ee, 0x01ef, 0x01ee, 0x01ee, 0x01ed, 0x01ec, 0x01eb, 0x01eb,
-        0x01eb, 0x01ec, 0x01ed, 0x01ee, 0x01ef, 0x01ef, 0x01ee, 0x01ed, 0x01ec, 0x01eb, 0x01eb,
-        0x01eb, 0x01ec, 0x01ed, 0x01ee, 0x01ef, 0x01ef, 0x01ef, 0x01ee, 0x01ed, 0x01ec, 0x01eb,
-        0x01ea, 0x01eb, 0x01ec, 0x01ed, 0x01ef, 0x01f0, 0x01f0, 0x01ef, 0x01ee, 0x01ec, 0x01eb,
-        0x01ea, 0x01e9, 0x01ea, 0x01ec, 0x01ee, 0x01f0, 0x01f1, 0x01f1, 0x01ef, 0x01ed, 0x01eb,
-        0x01e9, 0x01e8, 0x01e8, 0x01ea, 0x01ed, 0x01f0, 0x01f2, 0x01f4, 0x01f3, 0x01f0, 0x01ec,
-        0x01e7, 0x01e4, 0x01e3, 0x01e5, 0x01ea, 0x01f1, 0x01f8, 0x01fd, 0x01ff, 0x01f9, 0x01ec,
-        0x01d7, 0x01bb, 0x019b, 0xfe65, 0xfe45, 0xfe29, 0xfe14, 0xfe07, 0xfe01, 0xfe03, 0xfe08,
-        0xfe0f, 0xfe16, 0xfe1b, 0xfe1d, 0xfe1c, 0xfe19, 0xfe14, 0xfe10, 0xfe0d, 0xfe0c, 0xfe0e,
-        0xfe10, 0xfe13, 0xfe16, 0xfe18, 0xfe18, 0xfe17, 0xfe15, 0xfe13, 0xfe11, 0xfe0f, 0xfe0f,
-        0xfe10, 0xfe12, 0xfe14, 0xfe16, 0xfe17, 0xfe16, 0xfe15, 0xfe14, 0xfe12, 0xfe11, 0xfe10,
-        0xfe10, 0xfe11, 0xfe13, 0xfe14, 0xfe15, 0xfe16, 0xfe15, 0xfe14, 0xfe13, 0xfe12, 0xfe11,
-        0xfe11, 0xfe11, 0xfe12, 0xfe13, 0xfe14, 0xfe15, 0xfe15, 0xfe15, 0xfe14, 0xfe13, 0xfe12,
-        0xfe11, 0xfe11, 0xfe12, 0xfe13, 0xfe14, 0xfe15, 0xfe15, 0xfe15, 0xfe14, 0xfe13, 0xfe12,
-        0xfe12, 0xfe11, 0xfe12, 0xfe12, 0xfe13, 0xfe14, 0xfe15, 0xfe15, 0xfe15, 0xfe14, 0xfe13,
-        0xfe12, 0xfe12, 0xfe12, 0xfe12, 0xfe13, 0xfe13, 0xfe14, 0xfe15, 0xfe15, 0xfe14, 0xfe14,
-        0xfe13, 0xfe12, 0xfe12, 0xfe12, 0xfe12, 0xfe13, 0xfe14, 0xfe14, 0xfe15, 0xfe15, 0xfe14,
-        0xfe13, 0xfe12, 0xfe12, 0xfe12, 0xfe12, 0xfe12, 0xfe13, 0xfe14, 0xfe14, 0xfe15, 0xfe14,
-        0xfe14, 0xfe13, 0xfe12, 0xfe12, 0xfe12, 0xfe12, 0xfe13, 0xfe13, 0xfe14, 0xfe15, 0xfe15,
-        0xfe14, 0xfe13, 0xfe13, 0xfe12, 0xfe12, 0xfe12, 0xfe12, 0xfe13, 0xfe14, 0xfe14, 0xfe15,
-        0xfe14, 0xfe14, 0xfe13, 0xfe12, 0xfe12, 0xfe12, 0xfe12, 0xfe12, 0xfe13, 0xfe14, 0xfe15,
-        0xfe15, 0xfe14, 0xfe14, 0xfe13, 0xfe12, 0xfe12, 0xfe12, 0xfe12, 0xfe13, 0xfe14, 0xfe14,
-        0xfe15, 0xfe15, 0xfe14, 0xfe13, 0xfe13, 0xfe12, 0xfe12, 0xfe12, 0xfe12, 0xfe13, 0xfe14,
-        0xfe15, 0xfe15, 0xfe15, 0xfe14, 0xfe13, 0xfe12, 0xfe12, 0xfe11, 0xfe12, 0xfe12, 0xfe13,
-        0xfe14, 0xfe15, 0xfe15, 0xfe15, 0xfe14, 0xfe13, 0xfe12, 0xfe11, 0xfe11, 0xfe12, 0xfe13,
-        0xfe14, 0xfe15, 0xfe15, 0xfe15, 0xfe14, 0xfe13, 0xfe12, 0xfe11, 0xfe11, 0xfe11, 0xfe12,
-        0xfe13, 0xfe14, 0xfe15, 0xfe16, 0xfe15, 0xfe14, 0xfe13, 0xfe11, 0xfe10, 0xfe10, 0xfe11,
-        0xfe12, 0xfe14, 0xfe15, 0xfe16, 0xfe17, 0xfe16, 0xfe14, 0xfe12, 0xfe10, 0xfe0f, 0xfe0f,
-        0xfe11, 0xfe13, 0xfe15, 0xfe17, 0xfe18, 0xfe18, 0xfe16, 0xfe13, 0xfe10, 0xfe0e, 0xfe0c,
-        0xfe0d, 0xfe10, 0xfe14, 0xfe19, 0xfe1c, 0xfe1d, 0xfe1b, 0xfe16, 0xfe0f, 0xfe08, 0xfe03,
-        0xfe01, 0xfe07, 0xfe14, 0xfe29, 0xfe45, 0xfe65,
+        0x01ee, 0x01ee, 0x01ee, 0x01ed, 0x01ed, 0x01ec, 0x01eb,
     },
     {
         0x014f, 0x016a, 0x0184, 0x019d, 0x01b4, 0x01c7, 0x01d9, 0x01e6, 0x01f1, 0x01f9, 0x01fd,
@@ -166,42 +64,7 @@ static const int16_t oscillator_blsquare[10][512] PROGMEM = {
         0x01e0, 0x01df, 0x01de, 0x01dd, 0x01dd, 0x01dc, 0x01dd, 0x01dd, 0x01de, 0x01e0, 0x01e1,
         0x01e2, 0x01e4, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x01e4, 0x01e3,
         0x01e2, 0x01e0, 0x01df, 0x01de, 0x01dd, 0x01dd, 0x01dd, 0x01dd, 0x01de, 0x01de, 0x01df,
-        0x01e1, 0x01e2, 0x01e3, 0x01e4, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e5, 0x01e4,
-        0x01e3, 0x01e2, 0x01e1, 0x01df, 0x01de, 0x01de, 0x01dd, 0x01dd, 0x01dd, 0x01dd, 0x01de,
-        0x01df, 0x01e0, 0x01e2, 0x01e3, 0x01e4, 0x01e5, 0x01e6, 0x01e6, 0x01e6, 0x01e6, 0x01e6,
-        0x01e5, 0x01e4, 0x01e2, 0x01e1, 0x01e0, 0x01de, 0x01dd, 0x01dd, 0x01dc, 0x01dd, 0x01dd,
-        0x01de, 0x01df, 0x01e0, 0x01e1, 0x01e3, 0x01e4, 0x01e5, 0x01e6, 0x01e7, 0x01e7, 0x01e7,
-        0x01e6, 0x01e5, 0x01e4, 0x01e3, 0x01e1, 0x01e0, 0x01de, 0x01dd, 0x01dc, 0x01dc, 0x01db,
-        0x01dc, 0x01dd, 0x01de, 0x01df, 0x01e1, 0x01e3, 0x01e4, 0x01e6, 0x01e7, 0x01e8, 0x01e9,
-        0x01e9, 0x01e8, 0x01e7, 0x01e5, 0x01e3, 0x01e1, 0x01df, 0x01dd, 0x01dc, 0x01da, 0x01d9,
-        0x01d9, 0x01d9, 0x01da, 0x01dc, 0x01de, 0x01e0, 0x01e3, 0x01e6, 0x01e8, 0x01ea, 0x01ec,
-        0x01ec, 0x01ec, 0x01ec, 0x01ea, 0x01e8, 0x01e5, 0x01e2, 0x01de, 0x01da, 0x01d7, 0x01d4,
-        0x01d3, 0x01d2, 0x01d2, 0x01d4, 0x01d6, 0x01da, 0x01df, 0x01e5, 0x01eb, 0x01f1, 0x01f6,
-        0x01fb, 0x01fe, 0x01fe, 0x01fd, 0x01f9, 0x01f1, 0x01e6, 0x01d9, 0x01c7, 0x01b4, 0x019d,
-        0x0184, 0x016a, 0x014f, 0xfeb1, 0xfe96, 0xfe7c, 0xfe63, 0xfe4c, 0xfe39, 0xfe27, 0xfe1a,
-        0xfe0f, 0xfe07, 0xfe03, 0xfe01, 0xfe02, 0xfe05, 0xfe0a, 0xfe0f, 0xfe15, 0xfe1b, 0xfe21,
-        0xfe26, 0xfe2a, 0xfe2c, 0xfe2e, 0xfe2e, 0xfe2d, 0xfe2c, 0xfe29, 0xfe26, 0xfe22, 0xfe1e,
-        0xfe1b, 0xfe18, 0xfe16, 0xfe14, 0xfe14, 0xfe14, 0xfe14, 0xfe16, 0xfe18, 0xfe1a, 0xfe1d,
-        0xfe20, 0xfe22, 0xfe24, 0xfe26, 0xfe27, 0xfe27, 0xfe27, 0xfe26, 0xfe24, 0xfe23, 0xfe21,
-        0xfe1f, 0xfe1d, 0xfe1b, 0xfe19, 0xfe18, 0xfe17, 0xfe17, 0xfe18, 0xfe19, 0xfe1a, 0xfe1c,
-        0xfe1d, 0xfe1f, 0xfe21, 0xfe22, 0xfe23, 0xfe24, 0xfe25, 0xfe24, 0xfe24, 0xfe23, 0xfe22,
-        0xfe20, 0xfe1f, 0xfe1d, 0xfe1c, 0xfe1b, 0xfe1a, 0xfe19, 0xfe19, 0xfe19, 0xfe1a, 0xfe1b,
-        0xfe1c, 0xfe1d, 0xfe1f, 0xfe20, 0xfe21, 0xfe22, 0xfe23, 0xfe23, 0xfe24, 0xfe23, 0xfe23,
-        0xfe22, 0xfe20, 0xfe1f, 0xfe1e, 0xfe1c, 0xfe1b, 0xfe1a, 0xfe1a, 0xfe1a, 0xfe1a, 0xfe1a,
-        0xfe1b, 0xfe1c, 0xfe1d, 0xfe1e, 0xfe20, 0xfe21, 0xfe22, 0xfe23, 0xfe23, 0xfe23, 0xfe23,
-        0xfe22, 0xfe22, 0xfe21, 0xfe1f, 0xfe1e, 0xfe1d, 0xfe1c, 0xfe1b, 0xfe1a, 0xfe1a, 0xfe1a,
-        0xfe1a, 0xfe1b, 0xfe1c, 0xfe1d, 0xfe1e, 0xfe1f, 0xfe21, 0xfe22, 0xfe22, 0xfe23, 0xfe23,
-        0xfe23, 0xfe23, 0xfe22, 0xfe21, 0xfe20, 0xfe1e, 0xfe1d, 0xfe1c, 0xfe1b, 0xfe1a, 0xfe1a,
-        0xfe1a, 0xfe1a, 0xfe1a, 0xfe1b, 0xfe1c, 0xfe1e, 0xfe1f, 0xfe20, 0xfe22, 0xfe23, 0xfe23,
-        0xfe24, 0xfe23, 0xfe23, 0xfe22, 0xfe21, 0xfe20, 0xfe1f, 0xfe1d, 0xfe1c, 0xfe1b, 0xfe1a,
-        0xfe19, 0xfe19, 0xfe19, 0xfe1a, 0xfe1b, 0xfe1c, 0xfe1d, 0xfe1f, 0xfe20, 0xfe22, 0xfe23,
-        0xfe24, 0xfe24, 0xfe25, 0xfe24, 0xfe23, 0xfe22, 0xfe21, 0xfe1f, 0xfe1d, 0xfe1c, 0xfe1a,
-        0xfe19, 0xfe18, 0xfe17, 0xfe17, 0xfe18, 0xfe19, 0xfe1b, 0xfe1d, 0xfe1f, 0xfe21, 0xfe23,
-        0xfe24, 0xfe26, 0xfe27, 0xfe27, 0xfe27, 0xfe26, 0xfe24, 0xfe22, 0xfe20, 0xfe1d, 0xfe1a,
-        0xfe18, 0xfe16, 0xfe14, 0xfe14, 0xfe14, 0xfe14, 0xfe16, 0xfe18, 0xfe1b, 0xfe1e, 0xfe22,
-        0xfe26, 0xfe29, 0xfe2c, 0xfe2d, 0xfe2e, 0xfe2e, 0xfe2c, 0xfe2a, 0xfe26, 0xfe21, 0xfe1b,
-        0xfe15, 0xfe0f, 0xfe0a, 0xfe05, 0xfe02, 0xfe01, 0xfe03, 0xfe07, 0xfe0f, 0xfe1a, 0xfe27,
-        0xfe39, 0xfe4c, 0xfe63, 0xfe7c, 0xfe96, 0xfeb1,
+        0x01e1, 0x01e2, 0x01e3, 0x01e4, 0x01e5, 0x01e6, 0x01e6,
     },
     {
         0x01fe, 0x01d8, 0x01fe, 0x01d9, 0x01fe, 0x01d9, 0x01fd, 0x01db, 0x01fb, 0x01dc, 0x01fa,
@@ -215,42 +78,7 @@ static const int16_t oscillator_blsquare[10][512] PROGMEM = {
         0x01e9, 0x01ed, 0x01e9, 0x01ed, 0x01e9, 0x01ed, 0x01ea, 0x01ed, 0x01ea, 0x01ec, 0x01ea,
         0x01ec, 0x01eb, 0x01ec, 0x01eb, 0x01eb, 0x01ec, 0x01eb, 0x01ec, 0x01ea, 0x01ed, 0x01ea,
         0x01ed, 0x01ea, 0x01ed, 0x01e9, 0x01ed, 0x01e9, 0x01ed, 0x01e9, 0x01ed, 0x01ea, 0x01ed,
-        0x01ea, 0x01ec, 0x01ea, 0x01ec, 0x01eb, 0x01ec, 0x01eb, 0x01eb, 0x01ec, 0x01eb, 0x01ec,
-        0x01ea, 0x01ec, 0x01ea, 0x01ed, 0x01ea, 0x01ed, 0x01e9, 0x01ed, 0x01e9, 0x01ed, 0x01e9,
-        0x01ed, 0x01ea, 0x01ed, 0x01ea, 0x01ed, 0x01ea, 0x01ec, 0x01eb, 0x01ec, 0x01eb, 0x01eb,
-        0x01ec, 0x01eb, 0x01ec, 0x01ea, 0x01ec, 0x01ea, 0x01ed, 0x01ea, 0x01ed, 0x01e9, 0x01ed,
-        0x01e9, 0x01ed, 0x01e9, 0x01ed, 0x01e9, 0x01ed, 0x01e9, 0x01ed, 0x01ea, 0x01ed, 0x01ea,
-        0x01ec, 0x01eb, 0x01eb, 0x01eb, 0x01eb, 0x01ec, 0x01ea, 0x01ed, 0x01ea, 0x01ed, 0x01e9,
-        0x01ed, 0x01e9, 0x01ee, 0x01e9, 0x01ee, 0x01e9, 0x01ee, 0x01e9, 0x01ee, 0x01e9, 0x01ee,
-        0x01e9, 0x01ed, 0x01ea, 0x01ed, 0x01ea, 0x01ec, 0x01eb, 0x01eb, 0x01ec, 0x01ea, 0x01ed,
-        0x01e9, 0x01ee, 0x01e9, 0x01ee, 0x01e8, 0x01ef, 0x01e7, 0x01ef, 0x01e7, 0x01f0, 0x01e7,
-        0x01f0, 0x01e7, 0x01ef, 0x01e8, 0x01ef, 0x01e8, 0x01ee, 0x01e9, 0x01ed, 0x01eb, 0x01eb,
-        0x01ec, 0x01ea, 0x01ee, 0x01e8, 0x01f0, 0x01e6, 0x01f2, 0x01e4, 0x01f4, 0x01e2, 0x01f6,
-        0x01e0, 0x01f8, 0x01de, 0x01fa, 0x01dc, 0x01fb, 0x01db, 0x01fd, 0x01d9, 0x01fe, 0x01d9,
-        0x01fe, 0x01d8, 0x01fe, 0xfe01, 0xfe28, 0xfe02, 0xfe27, 0xfe02, 0xfe27, 0xfe03, 0xfe25,
-        0xfe05, 0xfe24, 0xfe06, 0xfe22, 0xfe08, 0xfe20, 0xfe0a, 0xfe1e, 0xfe0c, 0xfe1c, 0xfe0e,
-        0xfe1a, 0xfe10, 0xfe18, 0xfe12, 0xfe16, 0xfe14, 0xfe15, 0xfe15, 0xfe13, 0xfe17, 0xfe12,
-        0xfe18, 0xfe11, 0xfe18, 0xfe11, 0xfe19, 0xfe10, 0xfe19, 0xfe10, 0xfe19, 0xfe11, 0xfe19,
-        0xfe11, 0xfe18, 0xfe12, 0xfe17, 0xfe12, 0xfe17, 0xfe13, 0xfe16, 0xfe14, 0xfe15, 0xfe15,
-        0xfe14, 0xfe16, 0xfe13, 0xfe16, 0xfe13, 0xfe17, 0xfe12, 0xfe17, 0xfe12, 0xfe17, 0xfe12,
-        0xfe17, 0xfe12, 0xfe17, 0xfe12, 0xfe17, 0xfe13, 0xfe17, 0xfe13, 0xfe16, 0xfe13, 0xfe16,
-        0xfe14, 0xfe15, 0xfe15, 0xfe15, 0xfe15, 0xfe14, 0xfe16, 0xfe13, 0xfe16, 0xfe13, 0xfe17,
-        0xfe13, 0xfe17, 0xfe13, 0xfe17, 0xfe13, 0xfe17, 0xfe13, 0xfe17, 0xfe13, 0xfe16, 0xfe13,
-        0xfe16, 0xfe14, 0xfe16, 0xfe14, 0xfe15, 0xfe14, 0xfe15, 0xfe15, 0xfe14, 0xfe15, 0xfe14,
-        0xfe16, 0xfe13, 0xfe16, 0xfe13, 0xfe16, 0xfe13, 0xfe17, 0xfe13, 0xfe17, 0xfe13, 0xfe17,
-        0xfe13, 0xfe16, 0xfe13, 0xfe16, 0xfe14, 0xfe16, 0xfe14, 0xfe15, 0xfe14, 0xfe15, 0xfe15,
-        0xfe14, 0xfe15, 0xfe14, 0xfe16, 0xfe14, 0xfe16, 0xfe13, 0xfe16, 0xfe13, 0xfe17, 0xfe13,
-        0xfe17, 0xfe13, 0xfe17, 0xfe13, 0xfe16, 0xfe13, 0xfe16, 0xfe13, 0xfe16, 0xfe14, 0xfe15,
-        0xfe14, 0xfe15, 0xfe15, 0xfe14, 0xfe15, 0xfe14, 0xfe16, 0xfe14, 0xfe16, 0xfe13, 0xfe16,
-        0xfe13, 0xfe17, 0xfe13, 0xfe17, 0xfe13, 0xfe17, 0xfe13, 0xfe17, 0xfe13, 0xfe17, 0xfe13,
-        0xfe16, 0xfe13, 0xfe16, 0xfe14, 0xfe15, 0xfe15, 0xfe15, 0xfe15, 0xfe14, 0xfe16, 0xfe13,
-        0xfe16, 0xfe13, 0xfe17, 0xfe13, 0xfe17, 0xfe12, 0xfe17, 0xfe12, 0xfe17, 0xfe12, 0xfe17,
-        0xfe12, 0xfe17, 0xfe12, 0xfe17, 0xfe13, 0xfe16, 0xfe13, 0xfe16, 0xfe14, 0xfe15, 0xfe15,
-        0xfe14, 0xfe16, 0xfe13, 0xfe17, 0xfe12, 0xfe17, 0xfe12, 0xfe18, 0xfe11, 0xfe19, 0xfe11,
-        0xfe19, 0xfe10, 0xfe19, 0xfe10, 0xfe19, 0xfe11, 0xfe18, 0xfe11, 0xfe18, 0xfe12, 0xfe17,
-        0xfe13, 0xfe15, 0xfe15, 0xfe14, 0xfe16, 0xfe12, 0xfe18, 0xfe10, 0xfe1a, 0xfe0e, 0xfe1c,
-        0xfe0c, 0xfe1e, 0xfe0a, 0xfe20, 0xfe08, 0xfe22, 0xfe06, 0xfe24, 0xfe05, 0xfe25, 0xfe03,
-        0xfe27, 0xfe02, 0xfe27, 0xfe02, 0xfe28, 0xfe01,
+        0x01ea, 0x01ec, 0x01ea, 0x01ec, 0x01eb, 0x01ec, 0x01eb,
     },
     {
         0x00e6, 0x01fe, 0x01ea, 0x018f, 0x01a3, 0x01d7, 0x01c3, 0x01a0, 0x01b4, 0x01cd, 0x01ba,
@@ -264,42 +92,7 @@ static const int16_t oscillator_blsquare[10][512] PROGMEM = {
         0x01b7, 0x01bb, 0x01ba, 0x01b6, 0x01b8, 0x01bb, 0x01b9, 0x01b6, 0x01b9, 0x01bb, 0x01b8,
         0x01b6, 0x01b9, 0x01bb, 0x01b8, 0x01b7, 0x01ba, 0x01bb, 0x01b7, 0x01b7, 0x01bb, 0x01ba,
         0x01b7, 0x01b8, 0x01bb, 0x01b9, 0x01b6, 0x01b8, 0x01bb, 0x01b9, 0x01b6, 0x01b9, 0x01bb,
-        0x01b8, 0x01b6, 0x01ba, 0x01bb, 0x01b7, 0x01b7, 0x01ba, 0x01ba, 0x01b7, 0x01b7, 0x01bb,
-        0x01ba, 0x01b6, 0x01b8, 0x01bb, 0x01b9, 0x01b6, 0x01b9, 0x01bb, 0x01b8, 0x01b6, 0x01b9,
-        0x01bb, 0x01b8, 0x01b7, 0x01ba, 0x01bb, 0x01b7, 0x01b7, 0x01bb, 0x01ba, 0x01b7, 0x01b8,
-        0x01bb, 0x01b9, 0x01b6, 0x01b8, 0x01bb, 0x01b9, 0x01b6, 0x01b9, 0x01bb, 0x01b8, 0x01b6,
-        0x01ba, 0x01bb, 0x01b7, 0x01b6, 0x01ba, 0x01bb, 0x01b7, 0x01b7, 0x01bb, 0x01ba, 0x01b6,
-        0x01b8, 0x01bb, 0x01b9, 0x01b6, 0x01b8, 0x01bc, 0x01b8, 0x01b6, 0x01b9, 0x01bc, 0x01b7,
-        0x01b6, 0x01ba, 0x01bb, 0x01b7, 0x01b6, 0x01bb, 0x01bb, 0x01b6, 0x01b7, 0x01bc, 0x01ba,
-        0x01b5, 0x01b8, 0x01bc, 0x01b9, 0x01b5, 0x01b9, 0x01bd, 0x01b8, 0x01b5, 0x01ba, 0x01bd,
-        0x01b7, 0x01b5, 0x01bb, 0x01bc, 0x01b5, 0x01b6, 0x01bd, 0x01bb, 0x01b4, 0x01b7, 0x01be,
-        0x01ba, 0x01b3, 0x01b8, 0x01bf, 0x01b8, 0x01b2, 0x01ba, 0x01bf, 0x01b6, 0x01b2, 0x01bc,
-        0x01bf, 0x01b4, 0x01b2, 0x01bf, 0x01bf, 0x01b1, 0x01b3, 0x01c2, 0x01bd, 0x01ad, 0x01b5,
-        0x01c7, 0x01ba, 0x01a8, 0x01ba, 0x01cd, 0x01b4, 0x01a0, 0x01c3, 0x01d7, 0x01a3, 0x018f,
-        0x01ea, 0x01fe, 0x00e6, 0xff1a, 0xfe01, 0xfe16, 0xfe71, 0xfe5d, 0xfe29, 0xfe3d, 0xfe60,
-        0xfe4c, 0xfe33, 0xfe46, 0xfe58, 0xfe46, 0xfe39, 0xfe4b, 0xfe53, 0xfe43, 0xfe3e, 0xfe4d,
-        0xfe4f, 0xfe41, 0xfe41, 0xfe4e, 0xfe4c, 0xfe41, 0xfe44, 0xfe4e, 0xfe4a, 0xfe41, 0xfe46,
-        0xfe4e, 0xfe48, 0xfe41, 0xfe48, 0xfe4d, 0xfe46, 0xfe42, 0xfe49, 0xfe4c, 0xfe45, 0xfe43,
-        0xfe4a, 0xfe4b, 0xfe44, 0xfe45, 0xfe4b, 0xfe49, 0xfe43, 0xfe46, 0xfe4b, 0xfe48, 0xfe43,
-        0xfe47, 0xfe4b, 0xfe47, 0xfe44, 0xfe48, 0xfe4b, 0xfe46, 0xfe44, 0xfe49, 0xfe4a, 0xfe45,
-        0xfe45, 0xfe4a, 0xfe49, 0xfe45, 0xfe46, 0xfe4a, 0xfe49, 0xfe44, 0xfe47, 0xfe4a, 0xfe48,
-        0xfe44, 0xfe48, 0xfe4a, 0xfe47, 0xfe45, 0xfe48, 0xfe4a, 0xfe46, 0xfe45, 0xfe49, 0xfe49,
-        0xfe45, 0xfe46, 0xfe4a, 0xfe49, 0xfe45, 0xfe46, 0xfe4a, 0xfe48, 0xfe45, 0xfe47, 0xfe4a,
-        0xfe47, 0xfe45, 0xfe48, 0xfe4a, 0xfe47, 0xfe45, 0xfe48, 0xfe49, 0xfe46, 0xfe45, 0xfe49,
-        0xfe49, 0xfe45, 0xfe46, 0xfe49, 0xfe48, 0xfe45, 0xfe47, 0xfe4a, 0xfe48, 0xfe45, 0xfe47,
-        0xfe4a, 0xfe47, 0xfe45, 0xfe48, 0xfe4a, 0xfe46, 0xfe45, 0xfe49, 0xfe49, 0xfe46, 0xfe46,
-        0xfe49, 0xfe49, 0xfe45, 0xfe46, 0xfe4a, 0xfe48, 0xfe45, 0xfe47, 0xfe4a, 0xfe47, 0xfe45,
-        0xfe48, 0xfe4a, 0xfe47, 0xfe45, 0xfe48, 0xfe49, 0xfe46, 0xfe45, 0xfe49, 0xfe49, 0xfe45,
-        0xfe46, 0xfe49, 0xfe48, 0xfe45, 0xfe47, 0xfe4a, 0xfe48, 0xfe45, 0xfe47, 0xfe4a, 0xfe47,
-        0xfe45, 0xfe48, 0xfe4a, 0xfe46, 0xfe45, 0xfe49, 0xfe4a, 0xfe46, 0xfe45, 0xfe49, 0xfe49,
-        0xfe45, 0xfe46, 0xfe4a, 0xfe48, 0xfe45, 0xfe47, 0xfe4a, 0xfe48, 0xfe44, 0xfe48, 0xfe4a,
-        0xfe47, 0xfe44, 0xfe49, 0xfe4a, 0xfe46, 0xfe45, 0xfe49, 0xfe4a, 0xfe45, 0xfe45, 0xfe4a,
-        0xfe49, 0xfe44, 0xfe46, 0xfe4b, 0xfe48, 0xfe44, 0xfe47, 0xfe4b, 0xfe47, 0xfe43, 0xfe48,
-        0xfe4b, 0xfe46, 0xfe43, 0xfe49, 0xfe4b, 0xfe45, 0xfe44, 0xfe4b, 0xfe4a, 0xfe43, 0xfe45,
-        0xfe4c, 0xfe49, 0xfe42, 0xfe46, 0xfe4d, 0xfe48, 0xfe41, 0xfe48, 0xfe4e, 0xfe46, 0xfe41,
-        0xfe4a, 0xfe4e, 0xfe44, 0xfe41, 0xfe4c, 0xfe4e, 0xfe41, 0xfe41, 0xfe4f, 0xfe4d, 0xfe3e,
-        0xfe43, 0xfe53, 0xfe4b, 0xfe39, 0xfe46, 0xfe58, 0xfe46, 0xfe33, 0xfe4c, 0xfe60, 0xfe3d,
-        0xfe29, 0xfe5d, 0xfe71, 0xfe16, 0xfe01, 0xff1a,
+        0x01b8, 0x01b6, 0x01ba, 0x01bb, 0x01b7, 0x01b7, 0x01ba,
     },
     {
         0x0070, 0x0138, 0x01c2, 0x01ff, 0x01f8, 0x01cc, 0x019e, 0x0188, 0x018e, 0x01a8, 0x01c3,
@@ -313,42 +106,7 @@ static const int16_t oscillator_blsquare[10][512] PROGMEM = {
         0x01b6, 0x01b7, 0x01b5, 0x01b1, 0x01ae, 0x01ae, 0x01b0, 0x01b4, 0x01b7, 0x01b6, 0x01b4,
         0x01b0, 0x01ae, 0x01ae, 0x01b1, 0x01b5, 0x01b7, 0x01b6, 0x01b3, 0x01af, 0x01ae, 0x01af,
         0x01b2, 0x01b5, 0x01b7, 0x01b5, 0x01b2, 0x01af, 0x01ae, 0x01b0, 0x01b3, 0x01b6, 0x01b6,
-        0x01b4, 0x01b1, 0x01ae, 0x01ae, 0x01b0, 0x01b4, 0x01b6, 0x01b6, 0x01b4, 0x01b0, 0x01ae,
-        0x01ae, 0x01b1, 0x01b4, 0x01b6, 0x01b6, 0x01b3, 0x01b0, 0x01ae, 0x01af, 0x01b2, 0x01b5,
-        0x01b7, 0x01b5, 0x01b2, 0x01af, 0x01ae, 0x01af, 0x01b3, 0x01b6, 0x01b7, 0x01b5, 0x01b1,
-        0x01ae, 0x01ae, 0x01b0, 0x01b4, 0x01b6, 0x01b7, 0x01b4, 0x01b0, 0x01ae, 0x01ae, 0x01b1,
-        0x01b5, 0x01b7, 0x01b6, 0x01b3, 0x01af, 0x01ad, 0x01ae, 0x01b2, 0x01b6, 0x01b7, 0x01b6,
-        0x01b2, 0x01ae, 0x01ad, 0x01af, 0x01b3, 0x01b7, 0x01b8, 0x01b5, 0x01b1, 0x01ad, 0x01ad,
-        0x01af, 0x01b4, 0x01b8, 0x01b8, 0x01b5, 0x01b0, 0x01ac, 0x01ad, 0x01b0, 0x01b5, 0x01b9,
-        0x01b8, 0x01b3, 0x01ae, 0x01ab, 0x01ad, 0x01b2, 0x01b7, 0x01ba, 0x01b8, 0x01b2, 0x01ac,
-        0x01aa, 0x01ad, 0x01b3, 0x01b9, 0x01bb, 0x01b7, 0x01b0, 0x01aa, 0x01a9, 0x01ae, 0x01b5,
-        0x01bb, 0x01bc, 0x01b6, 0x01ae, 0x01a7, 0x01a8, 0x01af, 0x01b8, 0x01bf, 0x01be, 0x01b5,
-        0x01aa, 0x01a3, 0x01a6, 0x01b1, 0x01be, 0x01c4, 0x01c0, 0x01b2, 0x01a2, 0x019c, 0x01a3,
-        0x01b6, 0x01c9, 0x01d0, 0x01c3, 0x01a8, 0x018e, 0x0188, 0x019e, 0x01cc, 0x01f8, 0x01ff,
-        0x01c2, 0x0138, 0x0070, 0xff90, 0xfec8, 0xfe3e, 0xfe02, 0xfe08, 0xfe34, 0xfe62, 0xfe78,
-        0xfe72, 0xfe58, 0xfe3d, 0xfe30, 0xfe37, 0xfe4a, 0xfe5d, 0xfe64, 0xfe5e, 0xfe4e, 0xfe40,
-        0xfe3c, 0xfe42, 0xfe4f, 0xfe5a, 0xfe5d, 0xfe56, 0xfe4b, 0xfe42, 0xfe41, 0xfe48, 0xfe51,
-        0xfe58, 0xfe59, 0xfe52, 0xfe4a, 0xfe44, 0xfe45, 0xfe4b, 0xfe52, 0xfe57, 0xfe56, 0xfe50,
-        0xfe49, 0xfe45, 0xfe47, 0xfe4d, 0xfe53, 0xfe56, 0xfe54, 0xfe4e, 0xfe48, 0xfe46, 0xfe49,
-        0xfe4e, 0xfe53, 0xfe55, 0xfe52, 0xfe4d, 0xfe48, 0xfe47, 0xfe4b, 0xfe50, 0xfe53, 0xfe54,
-        0xfe50, 0xfe4b, 0xfe48, 0xfe48, 0xfe4c, 0xfe51, 0xfe53, 0xfe53, 0xfe4f, 0xfe4b, 0xfe48,
-        0xfe49, 0xfe4d, 0xfe51, 0xfe53, 0xfe52, 0xfe4e, 0xfe4a, 0xfe49, 0xfe4a, 0xfe4e, 0xfe52,
-        0xfe53, 0xfe51, 0xfe4d, 0xfe4a, 0xfe49, 0xfe4b, 0xfe4f, 0xfe52, 0xfe52, 0xfe50, 0xfe4c,
-        0xfe49, 0xfe4a, 0xfe4c, 0xfe50, 0xfe52, 0xfe52, 0xfe4f, 0xfe4b, 0xfe49, 0xfe4a, 0xfe4d,
-        0xfe51, 0xfe52, 0xfe51, 0xfe4e, 0xfe4b, 0xfe49, 0xfe4b, 0xfe4e, 0xfe51, 0xfe52, 0xfe50,
-        0xfe4d, 0xfe4a, 0xfe4a, 0xfe4c, 0xfe4f, 0xfe52, 0xfe52, 0xfe50, 0xfe4c, 0xfe4a, 0xfe4a,
-        0xfe4c, 0xfe50, 0xfe52, 0xfe52, 0xfe4f, 0xfe4c, 0xfe4a, 0xfe4a, 0xfe4d, 0xfe50, 0xfe52,
-        0xfe51, 0xfe4e, 0xfe4b, 0xfe49, 0xfe4b, 0xfe4e, 0xfe51, 0xfe52, 0xfe51, 0xfe4d, 0xfe4a,
-        0xfe49, 0xfe4b, 0xfe4f, 0xfe52, 0xfe52, 0xfe50, 0xfe4c, 0xfe4a, 0xfe49, 0xfe4c, 0xfe50,
-        0xfe52, 0xfe52, 0xfe4f, 0xfe4b, 0xfe49, 0xfe4a, 0xfe4d, 0xfe51, 0xfe53, 0xfe52, 0xfe4e,
-        0xfe4a, 0xfe49, 0xfe4a, 0xfe4e, 0xfe52, 0xfe53, 0xfe51, 0xfe4d, 0xfe49, 0xfe48, 0xfe4b,
-        0xfe4f, 0xfe53, 0xfe53, 0xfe51, 0xfe4c, 0xfe48, 0xfe48, 0xfe4b, 0xfe50, 0xfe54, 0xfe53,
-        0xfe50, 0xfe4b, 0xfe47, 0xfe48, 0xfe4d, 0xfe52, 0xfe55, 0xfe53, 0xfe4e, 0xfe49, 0xfe46,
-        0xfe48, 0xfe4e, 0xfe54, 0xfe56, 0xfe53, 0xfe4d, 0xfe47, 0xfe45, 0xfe49, 0xfe50, 0xfe56,
-        0xfe57, 0xfe52, 0xfe4b, 0xfe45, 0xfe44, 0xfe4a, 0xfe52, 0xfe59, 0xfe58, 0xfe51, 0xfe48,
-        0xfe41, 0xfe42, 0xfe4b, 0xfe56, 0xfe5d, 0xfe5a, 0xfe4f, 0xfe42, 0xfe3c, 0xfe40, 0xfe4e,
-        0xfe5e, 0xfe64, 0xfe5d, 0xfe4a, 0xfe37, 0xfe30, 0xfe3d, 0xfe58, 0xfe72, 0xfe78, 0xfe62,
-        0xfe34, 0xfe08, 0xfe01, 0xfe3e, 0xfec8, 0xff90,
+        0x01b4, 0x01b1, 0x01ae, 0x01ae, 0x01b0, 0x01b4, 0x01b6,
     },
     {
         0x0036, 0x00a0, 0x0101, 0x0156, 0x019c, 0x01cf, 0x01ef, 0x01fe, 0x01fe, 0x01f3, 0x01df,
@@ -362,42 +120,7 @@ static const int16_t oscillator_blsquare[10][512] PROGMEM = {
         0x01bb, 0x01ba, 0x01b7, 0x01b4, 0x01b0, 0x01ad, 0x01aa, 0x01a9, 0x01a9, 0x01aa, 0x01ad,
         0x01b0, 0x01b3, 0x01b7, 0x01b9, 0x01bb, 0x01bb, 0x01b9, 0x01b7, 0x01b4, 0x01b0, 0x01ad,
         0x01aa, 0x01a9, 0x01a9, 0x01aa, 0x01ad, 0x01b0, 0x01b3, 0x01b7, 0x01b9, 0x01ba, 0x01ba,
-        0x01b9, 0x01b7, 0x01b3, 0x01b0, 0x01ad, 0x01ab, 0x01a9, 0x01a9, 0x01ab, 0x01ad, 0x01b0,
-        0x01b3, 0x01b7, 0x01b9, 0x01ba, 0x01ba, 0x01b9, 0x01b7, 0x01b3, 0x01b0, 0x01ad, 0x01aa,
-        0x01a9, 0x01a9, 0x01aa, 0x01ad, 0x01b0, 0x01b4, 0x01b7, 0x01b9, 0x01bb, 0x01bb, 0x01b9,
-        0x01b7, 0x01b3, 0x01b0, 0x01ad, 0x01aa, 0x01a9, 0x01a9, 0x01aa, 0x01ad, 0x01b0, 0x01b4,
-        0x01b7, 0x01ba, 0x01bb, 0x01bb, 0x01ba, 0x01b7, 0x01b4, 0x01b0, 0x01ac, 0x01a9, 0x01a8,
-        0x01a8, 0x01a9, 0x01ac, 0x01b0, 0x01b4, 0x01b8, 0x01bb, 0x01bd, 0x01bd, 0x01bb, 0x01b8,
-        0x01b4, 0x01af, 0x01ab, 0x01a8, 0x01a6, 0x01a6, 0x01a8, 0x01ab, 0x01b0, 0x01b5, 0x01b9,
-        0x01bd, 0x01bf, 0x01bf, 0x01bd, 0x01b9, 0x01b4, 0x01ae, 0x01a9, 0x01a5, 0x01a2, 0x01a2,
-        0x01a5, 0x01a9, 0x01af, 0x01b6, 0x01bc, 0x01c1, 0x01c4, 0x01c4, 0x01c1, 0x01bc, 0x01b4,
-        0x01ac, 0x01a5, 0x019f, 0x019c, 0x019c, 0x019f, 0x01a6, 0x01af, 0x01b9, 0x01c3, 0x01ca,
-        0x01cf, 0x01cf, 0x01ca, 0x01c1, 0x01b5, 0x01a7, 0x0199, 0x018e, 0x0188, 0x0188, 0x018f,
-        0x019d, 0x01b1, 0x01c8, 0x01df, 0x01f3, 0x01fe, 0x01fe, 0x01ef, 0x01cf, 0x019c, 0x0156,
-        0x0101, 0x00a0, 0x0036, 0xffca, 0xff60, 0xfeff, 0xfeaa, 0xfe64, 0xfe31, 0xfe11, 0xfe01,
-        0xfe01, 0xfe0d, 0xfe21, 0xfe38, 0xfe4f, 0xfe63, 0xfe71, 0xfe78, 0xfe78, 0xfe72, 0xfe67,
-        0xfe59, 0xfe4b, 0xfe3f, 0xfe36, 0xfe31, 0xfe31, 0xfe36, 0xfe3d, 0xfe47, 0xfe51, 0xfe5a,
-        0xfe61, 0xfe64, 0xfe64, 0xfe61, 0xfe5b, 0xfe54, 0xfe4c, 0xfe44, 0xfe3f, 0xfe3c, 0xfe3c,
-        0xfe3f, 0xfe44, 0xfe4a, 0xfe51, 0xfe57, 0xfe5b, 0xfe5e, 0xfe5e, 0xfe5b, 0xfe57, 0xfe52,
-        0xfe4c, 0xfe47, 0xfe43, 0xfe41, 0xfe41, 0xfe43, 0xfe47, 0xfe4b, 0xfe50, 0xfe55, 0xfe58,
-        0xfe5a, 0xfe5a, 0xfe58, 0xfe55, 0xfe51, 0xfe4c, 0xfe48, 0xfe45, 0xfe43, 0xfe43, 0xfe45,
-        0xfe48, 0xfe4c, 0xfe50, 0xfe54, 0xfe57, 0xfe58, 0xfe58, 0xfe57, 0xfe54, 0xfe50, 0xfe4c,
-        0xfe49, 0xfe46, 0xfe45, 0xfe45, 0xfe46, 0xfe49, 0xfe4c, 0xfe50, 0xfe53, 0xfe56, 0xfe57,
-        0xfe57, 0xfe56, 0xfe53, 0xfe50, 0xfe4d, 0xfe49, 0xfe47, 0xfe45, 0xfe45, 0xfe47, 0xfe49,
-        0xfe4c, 0xfe50, 0xfe53, 0xfe56, 0xfe57, 0xfe57, 0xfe56, 0xfe53, 0xfe50, 0xfe4d, 0xfe49,
-        0xfe47, 0xfe46, 0xfe46, 0xfe47, 0xfe49, 0xfe4d, 0xfe50, 0xfe53, 0xfe55, 0xfe57, 0xfe57,
-        0xfe55, 0xfe53, 0xfe50, 0xfe4d, 0xfe49, 0xfe47, 0xfe46, 0xfe46, 0xfe47, 0xfe49, 0xfe4d,
-        0xfe50, 0xfe53, 0xfe56, 0xfe57, 0xfe57, 0xfe56, 0xfe53, 0xfe50, 0xfe4c, 0xfe49, 0xfe47,
-        0xfe45, 0xfe45, 0xfe47, 0xfe49, 0xfe4d, 0xfe50, 0xfe53, 0xfe56, 0xfe57, 0xfe57, 0xfe56,
-        0xfe53, 0xfe50, 0xfe4c, 0xfe49, 0xfe46, 0xfe45, 0xfe45, 0xfe46, 0xfe49, 0xfe4c, 0xfe50,
-        0xfe54, 0xfe57, 0xfe58, 0xfe58, 0xfe57, 0xfe54, 0xfe50, 0xfe4c, 0xfe48, 0xfe45, 0xfe43,
-        0xfe43, 0xfe45, 0xfe48, 0xfe4c, 0xfe51, 0xfe55, 0xfe58, 0xfe5a, 0xfe5a, 0xfe58, 0xfe55,
-        0xfe50, 0xfe4b, 0xfe47, 0xfe43, 0xfe41, 0xfe41, 0xfe43, 0xfe47, 0xfe4c, 0xfe52, 0xfe57,
-        0xfe5b, 0xfe5e, 0xfe5e, 0xfe5b, 0xfe57, 0xfe51, 0xfe4a, 0xfe44, 0xfe3f, 0xfe3c, 0xfe3c,
-        0xfe3f, 0xfe44, 0xfe4c, 0xfe54, 0xfe5b, 0xfe61, 0xfe64, 0xfe64, 0xfe61, 0xfe5a, 0xfe51,
-        0xfe47, 0xfe3d, 0xfe36, 0xfe31, 0xfe31, 0xfe36, 0xfe3f, 0xfe4b, 0xfe59, 0xfe67, 0xfe72,
-        0xfe78, 0xfe78, 0xfe71, 0xfe63, 0xfe4f, 0xfe38, 0xfe21, 0xfe0d, 0xfe01, 0xfe01, 0xfe11,
-        0xfe31, 0xfe64, 0xfeaa, 0xfeff, 0xff60, 0xffca,
+        0x01b9, 0x01b7, 0x01b3, 0x01b0, 0x01ad, 0x01ab, 0x01a9,
     },
     {
         0x001b, 0x0050, 0x0085, 0x00b8, 0x00e9, 0x0117, 0x0141, 0x0168, 0x018b, 0x01a9, 0x01c2,
@@ -411,42 +134,7 @@ static const int16_t oscillator_blsquare[10][512] PROGMEM = {
         0x01af, 0x01ac, 0x01a8, 0x01a5, 0x01a2, 0x01a0, 0x019f, 0x019e, 0x019e, 0x019f, 0x01a0,
         0x01a2, 0x01a5, 0x01a8, 0x01ab, 0x01af, 0x01b2, 0x01b6, 0x01b9, 0x01bc, 0x01be, 0x01c0,
         0x01c1, 0x01c2, 0x01c2, 0x01c1, 0x01c0, 0x01be, 0x01bc, 0x01b9, 0x01b6, 0x01b2, 0x01af,
-        0x01ac, 0x01a9, 0x01a6, 0x01a3, 0x01a2, 0x01a0, 0x01a0, 0x01a0, 0x01a0, 0x01a2, 0x01a3,
-        0x01a6, 0x01a9, 0x01ac, 0x01af, 0x01b2, 0x01b6, 0x01b9, 0x01bc, 0x01be, 0x01c0, 0x01c1,
-        0x01c2, 0x01c2, 0x01c1, 0x01c0, 0x01be, 0x01bc, 0x01b9, 0x01b6, 0x01b2, 0x01af, 0x01ab,
-        0x01a8, 0x01a5, 0x01a2, 0x01a0, 0x019f, 0x019e, 0x019e, 0x019f, 0x01a0, 0x01a2, 0x01a5,
-        0x01a8, 0x01ac, 0x01af, 0x01b3, 0x01b7, 0x01bb, 0x01be, 0x01c1, 0x01c3, 0x01c4, 0x01c5,
-        0x01c5, 0x01c4, 0x01c3, 0x01c0, 0x01be, 0x01ba, 0x01b6, 0x01b2, 0x01ad, 0x01a9, 0x01a5,
-        0x01a1, 0x019e, 0x019b, 0x019a, 0x0199, 0x0199, 0x019a, 0x019b, 0x019e, 0x01a2, 0x01a6,
-        0x01ab, 0x01b0, 0x01b5, 0x01bb, 0x01c0, 0x01c4, 0x01c8, 0x01cc, 0x01ce, 0x01cf, 0x01cf,
-        0x01ce, 0x01cb, 0x01c8, 0x01c3, 0x01be, 0x01b7, 0x01b0, 0x01a9, 0x01a2, 0x019b, 0x0195,
-        0x018f, 0x018a, 0x0187, 0x0186, 0x0186, 0x0187, 0x018b, 0x0190, 0x0197, 0x01a0, 0x01aa,
-        0x01b5, 0x01c1, 0x01cd, 0x01d8, 0x01e3, 0x01ed, 0x01f5, 0x01fb, 0x01fe, 0x01fe, 0x01fb,
-        0x01f3, 0x01e7, 0x01d7, 0x01c2, 0x01a9, 0x018b, 0x0168, 0x0141, 0x0117, 0x00e9, 0x00b8,
-        0x0085, 0x0050, 0x001b, 0xffe5, 0xffb0, 0xff7b, 0xff48, 0xff17, 0xfee9, 0xfebf, 0xfe98,
-        0xfe75, 0xfe57, 0xfe3e, 0xfe29, 0xfe19, 0xfe0d, 0xfe05, 0xfe01, 0xfe01, 0xfe05, 0xfe0b,
-        0xfe13, 0xfe1d, 0xfe28, 0xfe33, 0xfe3f, 0xfe4b, 0xfe56, 0xfe60, 0xfe69, 0xfe70, 0xfe75,
-        0xfe79, 0xfe7a, 0xfe7a, 0xfe79, 0xfe76, 0xfe71, 0xfe6b, 0xfe65, 0xfe5e, 0xfe57, 0xfe50,
-        0xfe49, 0xfe42, 0xfe3d, 0xfe38, 0xfe35, 0xfe32, 0xfe31, 0xfe31, 0xfe32, 0xfe34, 0xfe38,
-        0xfe3c, 0xfe40, 0xfe45, 0xfe4b, 0xfe50, 0xfe55, 0xfe5a, 0xfe5e, 0xfe62, 0xfe65, 0xfe66,
-        0xfe67, 0xfe67, 0xfe66, 0xfe65, 0xfe62, 0xfe5f, 0xfe5b, 0xfe57, 0xfe53, 0xfe4e, 0xfe4a,
-        0xfe46, 0xfe42, 0xfe40, 0xfe3d, 0xfe3c, 0xfe3b, 0xfe3b, 0xfe3c, 0xfe3d, 0xfe3f, 0xfe42,
-        0xfe45, 0xfe49, 0xfe4d, 0xfe51, 0xfe54, 0xfe58, 0xfe5b, 0xfe5e, 0xfe60, 0xfe61, 0xfe62,
-        0xfe62, 0xfe61, 0xfe60, 0xfe5e, 0xfe5b, 0xfe58, 0xfe55, 0xfe51, 0xfe4e, 0xfe4a, 0xfe47,
-        0xfe44, 0xfe42, 0xfe40, 0xfe3f, 0xfe3e, 0xfe3e, 0xfe3f, 0xfe40, 0xfe42, 0xfe44, 0xfe47,
-        0xfe4a, 0xfe4e, 0xfe51, 0xfe54, 0xfe57, 0xfe5a, 0xfe5d, 0xfe5e, 0xfe60, 0xfe60, 0xfe60,
-        0xfe60, 0xfe5e, 0xfe5d, 0xfe5a, 0xfe57, 0xfe54, 0xfe51, 0xfe4e, 0xfe4a, 0xfe47, 0xfe44,
-        0xfe42, 0xfe40, 0xfe3f, 0xfe3e, 0xfe3e, 0xfe3f, 0xfe40, 0xfe42, 0xfe44, 0xfe47, 0xfe4a,
-        0xfe4e, 0xfe51, 0xfe55, 0xfe58, 0xfe5b, 0xfe5e, 0xfe60, 0xfe61, 0xfe62, 0xfe62, 0xfe61,
-        0xfe60, 0xfe5e, 0xfe5b, 0xfe58, 0xfe54, 0xfe51, 0xfe4d, 0xfe49, 0xfe45, 0xfe42, 0xfe3f,
-        0xfe3d, 0xfe3c, 0xfe3b, 0xfe3b, 0xfe3c, 0xfe3d, 0xfe40, 0xfe42, 0xfe46, 0xfe4a, 0xfe4e,
-        0xfe53, 0xfe57, 0xfe5b, 0xfe5f, 0xfe62, 0xfe65, 0xfe66, 0xfe67, 0xfe67, 0xfe66, 0xfe65,
-        0xfe62, 0xfe5e, 0xfe5a, 0xfe55, 0xfe50, 0xfe4b, 0xfe45, 0xfe40, 0xfe3c, 0xfe38, 0xfe34,
-        0xfe32, 0xfe31, 0xfe31, 0xfe32, 0xfe35, 0xfe38, 0xfe3d, 0xfe42, 0xfe49, 0xfe50, 0xfe57,
-        0xfe5e, 0xfe65, 0xfe6b, 0xfe71, 0xfe76, 0xfe79, 0xfe7a, 0xfe7a, 0xfe79, 0xfe75, 0xfe70,
-        0xfe69, 0xfe60, 0xfe56, 0xfe4b, 0xfe3f, 0xfe33, 0xfe28, 0xfe1d, 0xfe13, 0xfe0b, 0xfe05,
-        0xfe01, 0xfe01, 0xfe05, 0xfe0d, 0xfe19, 0xfe29, 0xfe3e, 0xfe57, 0xfe75, 0xfe98, 0xfebf,
-        0xfee9, 0xff17, 0xff48, 0xff7b, 0xffb0, 0xffe5,
+        0x01ac, 0x01a9, 0x01a6, 0x01a3, 0x01a2, 0x01a0, 0x01a0,
     },
     {
         0x000d, 0x0028, 0x0043, 0x005d, 0x0078, 0x0092, 0x00ab, 0x00c4, 0x00dc, 0x00f4, 0x010b,
@@ -460,42 +148,7 @@ static const int16_t oscillator_blsquare[10][512] PROGMEM = {
         0x01ca, 0x01cc, 0x01ce, 0x01d0, 0x01d1, 0x01d2, 0x01d3, 0x01d4, 0x01d4, 0x01d3, 0x01d2,
         0x01d1, 0x01d0, 0x01ce, 0x01cc, 0x01ca, 0x01c8, 0x01c5, 0x01c2, 0x01bf, 0x01bc, 0x01b8,
         0x01b5, 0x01b2, 0x01ae, 0x01ab, 0x01a7, 0x01a4, 0x01a1, 0x019e, 0x019b, 0x0199, 0x0196,
-        0x0194, 0x0192, 0x0191, 0x018f, 0x018e, 0x018e, 0x018d, 0x018d, 0x018e, 0x018e, 0x018f,
-        0x0191, 0x0192, 0x0194, 0x0196, 0x0199, 0x019b, 0x019e, 0x01a1, 0x01a4, 0x01a7, 0x01ab,
-        0x01ae, 0x01b2, 0x01b5, 0x01b8, 0x01bc, 0x01bf, 0x01c2, 0x01c5, 0x01c8, 0x01ca, 0x01cc,
-        0x01ce, 0x01d0, 0x01d1, 0x01d2, 0x01d3, 0x01d4, 0x01d4, 0x01d3, 0x01d2, 0x01d1, 0x01d0,
-        0x01ce, 0x01cc, 0x01ca, 0x01c7, 0x01c4, 0x01c1, 0x01bd, 0x01ba, 0x01b6, 0x01b2, 0x01ae,
-        0x01aa, 0x01a6, 0x01a2, 0x019e, 0x019a, 0x0196, 0x0193, 0x018f, 0x018c, 0x0189, 0x0187,
-        0x0185, 0x0183, 0x0182, 0x0181, 0x0180, 0x0180, 0x0181, 0x0182, 0x0183, 0x0185, 0x0188,
-        0x018a, 0x018e, 0x0192, 0x0196, 0x019a, 0x019f, 0x01a4, 0x01aa, 0x01b0, 0x01b6, 0x01bc,
-        0x01c2, 0x01c8, 0x01ce, 0x01d4, 0x01da, 0x01e0, 0x01e5, 0x01ea, 0x01ef, 0x01f3, 0x01f7,
-        0x01fa, 0x01fc, 0x01fe, 0x01ff, 0x01ff, 0x01fe, 0x01fc, 0x01f9, 0x01f5, 0x01f0, 0x01ea,
-        0x01e3, 0x01db, 0x01d2, 0x01c7, 0x01bb, 0x01af, 0x01a1, 0x0192, 0x0181, 0x0170, 0x015e,
-        0x014a, 0x0136, 0x0121, 0x010b, 0x00f4, 0x00dc, 0x00c4, 0x00ab, 0x0092, 0x0078, 0x005d,
-        0x0043, 0x0028, 0x000d, 0xfff3, 0xffd8, 0xffbd, 0xffa3, 0xff88, 0xff6e, 0xff55, 0xff3c,
-        0xff24, 0xff0c, 0xfef5, 0xfedf, 0xfeca, 0xfeb6, 0xfea2, 0xfe90, 0xfe7f, 0xfe6e, 0xfe5f,
-        0xfe51, 0xfe45, 0xfe39, 0xfe2e, 0xfe25, 0xfe1d, 0xfe16, 0xfe10, 0xfe0b, 0xfe07, 0xfe04,
-        0xfe02, 0xfe01, 0xfe01, 0xfe02, 0xfe04, 0xfe06, 0xfe09, 0xfe0d, 0xfe11, 0xfe16, 0xfe1b,
-        0xfe20, 0xfe26, 0xfe2c, 0xfe32, 0xfe38, 0xfe3e, 0xfe44, 0xfe4a, 0xfe50, 0xfe56, 0xfe5c,
-        0xfe61, 0xfe66, 0xfe6a, 0xfe6e, 0xfe72, 0xfe76, 0xfe78, 0xfe7b, 0xfe7d, 0xfe7e, 0xfe7f,
-        0xfe80, 0xfe80, 0xfe7f, 0xfe7e, 0xfe7d, 0xfe7b, 0xfe79, 0xfe77, 0xfe74, 0xfe71, 0xfe6d,
-        0xfe6a, 0xfe66, 0xfe62, 0xfe5e, 0xfe5a, 0xfe56, 0xfe52, 0xfe4e, 0xfe4a, 0xfe46, 0xfe43,
-        0xfe3f, 0xfe3c, 0xfe39, 0xfe36, 0xfe34, 0xfe32, 0xfe30, 0xfe2f, 0xfe2e, 0xfe2d, 0xfe2c,
-        0xfe2c, 0xfe2d, 0xfe2e, 0xfe2f, 0xfe30, 0xfe32, 0xfe34, 0xfe36, 0xfe38, 0xfe3b, 0xfe3e,
-        0xfe41, 0xfe44, 0xfe48, 0xfe4b, 0xfe4e, 0xfe52, 0xfe55, 0xfe59, 0xfe5c, 0xfe5f, 0xfe62,
-        0xfe65, 0xfe67, 0xfe6a, 0xfe6c, 0xfe6e, 0xfe6f, 0xfe71, 0xfe72, 0xfe72, 0xfe73, 0xfe73,
-        0xfe72, 0xfe72, 0xfe71, 0xfe6f, 0xfe6e, 0xfe6c, 0xfe6a, 0xfe67, 0xfe65, 0xfe62, 0xfe5f,
-        0xfe5c, 0xfe59, 0xfe55, 0xfe52, 0xfe4e, 0xfe4b, 0xfe48, 0xfe44, 0xfe41, 0xfe3e, 0xfe3b,
-        0xfe38, 0xfe36, 0xfe34, 0xfe32, 0xfe30, 0xfe2f, 0xfe2e, 0xfe2d, 0xfe2c, 0xfe2c, 0xfe2d,
-        0xfe2e, 0xfe2f, 0xfe30, 0xfe32, 0xfe34, 0xfe36, 0xfe39, 0xfe3c, 0xfe3f, 0xfe43, 0xfe46,
-        0xfe4a, 0xfe4e, 0xfe52, 0xfe56, 0xfe5a, 0xfe5e, 0xfe62, 0xfe66, 0xfe6a, 0xfe6d, 0xfe71,
-        0xfe74, 0xfe77, 0xfe79, 0xfe7b, 0xfe7d, 0xfe7e, 0xfe7f, 0xfe80, 0xfe80, 0xfe7f, 0xfe7e,
-        0xfe7d, 0xfe7b, 0xfe78, 0xfe76, 0xfe72, 0xfe6e, 0xfe6a, 0xfe66, 0xfe61, 0xfe5c, 0xfe56,
-        0xfe50, 0xfe4a, 0xfe44, 0xfe3e, 0xfe38, 0xfe32, 0xfe2c, 0xfe26, 0xfe20, 0xfe1b, 0xfe16,
-        0xfe11, 0xfe0d, 0xfe09, 0xfe06, 0xfe04, 0xfe02, 0xfe01, 0xfe01, 0xfe02, 0xfe04, 0xfe07,
-        0xfe0b, 0xfe10, 0xfe16, 0xfe1d, 0xfe25, 0xfe2e, 0xfe39, 0xfe45, 0xfe51, 0xfe5f, 0xfe6e,
-        0xfe7f, 0xfe90, 0xfea2, 0xfeb6, 0xfeca, 0xfedf, 0xfef5, 0xff0c, 0xff24, 0xff3c, 0xff55,
-        0xff6e, 0xff88, 0xffa3, 0xffbd, 0xffd8, 0xfff3,
+        0x0194, 0x0192, 0x0191, 0x018f, 0x018e, 0x018e, 0x018d,
     },
     {
         0x0006, 0x0013, 0x0021, 0x002e, 0x003b, 0x0048, 0x0056, 0x0063, 0x0070, 0x007c, 0x0089,
@@ -509,48 +162,13 @@ static const int16_t oscillator_blsquare[10][512] PROGMEM = {
         0x01ca, 0x01c7, 0x01c3, 0x01bf, 0x01bc, 0x01b8, 0x01b5, 0x01b1, 0x01ad, 0x01aa, 0x01a6,
         0x01a3, 0x019f, 0x019c, 0x0198, 0x0195, 0x0192, 0x018f, 0x018c, 0x0189, 0x0186, 0x0183,
         0x0181, 0x017e, 0x017c, 0x0179, 0x0177, 0x0175, 0x0173, 0x0172, 0x0170, 0x016f, 0x016d,
-        0x016c, 0x016b, 0x016a, 0x016a, 0x0169, 0x0169, 0x0169, 0x0169, 0x0169, 0x0169, 0x016a,
-        0x016a, 0x016b, 0x016c, 0x016d, 0x016f, 0x0170, 0x0172, 0x0173, 0x0175, 0x0177, 0x0179,
-        0x017c, 0x017e, 0x0181, 0x0183, 0x0186, 0x0189, 0x018c, 0x018f, 0x0192, 0x0195, 0x0198,
-        0x019c, 0x019f, 0x01a3, 0x01a6, 0x01aa, 0x01ad, 0x01b1, 0x01b5, 0x01b8, 0x01bc, 0x01bf,
-        0x01c3, 0x01c7, 0x01ca, 0x01ce, 0x01d1, 0x01d4, 0x01d8, 0x01db, 0x01de, 0x01e1, 0x01e4,
-        0x01e7, 0x01ea, 0x01ec, 0x01ef, 0x01f1, 0x01f3, 0x01f5, 0x01f7, 0x01f8, 0x01fa, 0x01fb,
-        0x01fc, 0x01fd, 0x01fe, 0x01fe, 0x01ff, 0x01ff, 0x01fe, 0x01fe, 0x01fd, 0x01fc, 0x01fb,
-        0x01f9, 0x01f8, 0x01f6, 0x01f3, 0x01f1, 0x01ee, 0x01eb, 0x01e8, 0x01e4, 0x01e0, 0x01dc,
-        0x01d7, 0x01d2, 0x01cd, 0x01c8, 0x01c2, 0x01bc, 0x01b6, 0x01b0, 0x01a9, 0x01a2, 0x019a,
-        0x0193, 0x018b, 0x0183, 0x017a, 0x0171, 0x0169, 0x015f, 0x0156, 0x014c, 0x0142, 0x0138,
-        0x012e, 0x0123, 0x0118, 0x010d, 0x0102, 0x00f7, 0x00eb, 0x00e0, 0x00d4, 0x00c8, 0x00bb,
-        0x00af, 0x00a3, 0x0096, 0x0089, 0x007c, 0x0070, 0x0063, 0x0056, 0x0048, 0x003b, 0x002e,
-        0x0021, 0x0013, 0x0006, 0xfffa, 0xffed, 0xffdf, 0xffd2, 0xffc5, 0xffb8, 0xffaa, 0xff9d,
-        0xff90, 0xff84, 0xff77, 0xff6a, 0xff5d, 0xff51, 0xff45, 0xff38, 0xff2c, 0xff20, 0xff15,
-        0xff09, 0xfefe, 0xfef3, 0xfee8, 0xfedd, 0xfed2, 0xfec8, 0xfebe, 0xfeb4, 0xfeaa, 0xfea1,
-        0xfe97, 0xfe8f, 0xfe86, 0xfe7d, 0xfe75, 0xfe6d, 0xfe66, 0xfe5e, 0xfe57, 0xfe50, 0xfe4a,
-        0xfe44, 0xfe3e, 0xfe38, 0xfe33, 0xfe2e, 0xfe29, 0xfe24, 0xfe20, 0xfe1c, 0xfe18, 0xfe15,
-        0xfe12, 0xfe0f, 0xfe0d, 0xfe0a, 0xfe08, 0xfe07, 0xfe05, 0xfe04, 0xfe03, 0xfe02, 0xfe02,
-        0xfe02, 0xfe02, 0xfe02, 0xfe02, 0xfe03, 0xfe04, 0xfe05, 0xfe06, 0xfe08, 0xfe09, 0xfe0b,
-        0xfe0d, 0xfe0f, 0xfe11, 0xfe14, 0xfe16, 0xfe19, 0xfe1c, 0xfe1f, 0xfe22, 0xfe25, 0xfe28,
-        0xfe2c, 0xfe2f, 0xfe32, 0xfe36, 0xfe39, 0xfe3d, 0xfe41, 0xfe44, 0xfe48, 0xfe4b, 0xfe4f,
-        0xfe53, 0xfe56, 0xfe5a, 0xfe5d, 0xfe61, 0xfe64, 0xfe68, 0xfe6b, 0xfe6e, 0xfe71, 0xfe74,
-        0xfe77, 0xfe7a, 0xfe7d, 0xfe7f, 0xfe82, 0xfe84, 0xfe87, 0xfe89, 0xfe8b, 0xfe8d, 0xfe8e,
-        0xfe90, 0xfe91, 0xfe93, 0xfe94, 0xfe95, 0xfe96, 0xfe96, 0xfe97, 0xfe97, 0xfe97, 0xfe97,
-        0xfe97, 0xfe97, 0xfe96, 0xfe96, 0xfe95, 0xfe94, 0xfe93, 0xfe91, 0xfe90, 0xfe8e, 0xfe8d,
-        0xfe8b, 0xfe89, 0xfe87, 0xfe84, 0xfe82, 0xfe7f, 0xfe7d, 0xfe7a, 0xfe77, 0xfe74, 0xfe71,
-        0xfe6e, 0xfe6b, 0xfe68, 0xfe64, 0xfe61, 0xfe5d, 0xfe5a, 0xfe56, 0xfe53, 0xfe4f, 0xfe4b,
-        0xfe48, 0xfe44, 0xfe41, 0xfe3d, 0xfe39, 0xfe36, 0xfe32, 0xfe2f, 0xfe2c, 0xfe28, 0xfe25,
-        0xfe22, 0xfe1f, 0xfe1c, 0xfe19, 0xfe16, 0xfe14, 0xfe11, 0xfe0f, 0xfe0d, 0xfe0b, 0xfe09,
-        0xfe08, 0xfe06, 0xfe05, 0xfe04, 0xfe03, 0xfe02, 0xfe02, 0xfe01, 0xfe01, 0xfe02, 0xfe02,
-        0xfe03, 0xfe04, 0xfe05, 0xfe07, 0xfe08, 0xfe0a, 0xfe0d, 0xfe0f, 0xfe12, 0xfe15, 0xfe18,
-        0xfe1c, 0xfe20, 0xfe24, 0xfe29, 0xfe2e, 0xfe33, 0xfe38, 0xfe3e, 0xfe44, 0xfe4a, 0xfe50,
-        0xfe57, 0xfe5e, 0xfe66, 0xfe6d, 0xfe75, 0xfe7d, 0xfe86, 0xfe8f, 0xfe97, 0xfea1, 0xfeaa,
-        0xfeb4, 0xfebe, 0xfec8, 0xfed2, 0xfedd, 0xfee8, 0xfef3, 0xfefe, 0xff09, 0xff15, 0xff20,
-        0xff2c, 0xff38, 0xff45, 0xff51, 0xff5d, 0xff6a, 0xff77, 0xff84, 0xff90, 0xff9d, 0xffaa,
-        0xffb8, 0xffc5, 0xffd2, 0xffdf, 0xffed, 0xfffa,
+        0x016c, 0x016b, 0x016a, 0x016a, 0x0169, 0x0169, 0x0169,
     },
 };
 #define oscillator_blsquare_rows 10
-#define oscillator_blsquare_cols 512
+#define oscillator_blsquare_cols 128
 
-static const int16_t oscillator_bltriangle[10][512] PROGMEM = {
+static const int16_t oscillator_bltriangle[10][129] oscillator_wavetable_attr = {
     {
         0x0000, 0x0003, 0x0007, 0x000b, 0x000f, 0x0013, 0x0017, 0x001b, 0x001f, 0x0023, 0x0027,
         0x002b, 0x002f, 0x0033, 0x0037, 0x003b, 0x003f, 0x0043, 0x0047, 0x004b, 0x004f, 0x0053,
@@ -563,42 +181,7 @@ static const int16_t oscillator_bltriangle[10][512] PROGMEM = {
         0x015f, 0x0163, 0x0167, 0x016b, 0x016f, 0x0173, 0x0177, 0x017b, 0x017f, 0x0183, 0x0187,
         0x018b, 0x018f, 0x0193, 0x0197, 0x019b, 0x019f, 0x01a3, 0x01a7, 0x01ab, 0x01af, 0x01b3,
         0x01b7, 0x01bb, 0x01bf, 0x01c3, 0x01c7, 0x01cb, 0x01cf, 0x01d3, 0x01d7, 0x01db, 0x01df,
-        0x01e3, 0x01e7, 0x01eb, 0x01ef, 0x01f3, 0x01f7, 0x01fb, 0x01ff, 0x01fb, 0x01f7, 0x01f3,
-        0x01ef, 0x01eb, 0x01e7, 0x01e3, 0x01df, 0x01db, 0x01d7, 0x01d3, 0x01cf, 0x01cb, 0x01c7,
-        0x01c3, 0x01bf, 0x01bb, 0x01b7, 0x01b3, 0x01af, 0x01ab, 0x01a7, 0x01a3, 0x019f, 0x019b,
-        0x0197, 0x0193, 0x018f, 0x018b, 0x0187, 0x0183, 0x017f, 0x017b, 0x0177, 0x0173, 0x016f,
-        0x016b, 0x0167, 0x0163, 0x015f, 0x015b, 0x0157, 0x0153, 0x014f, 0x014b, 0x0147, 0x0143,
-        0x013f, 0x013b, 0x0137, 0x0133, 0x012f, 0x012b, 0x0127, 0x0123, 0x011f, 0x011b, 0x0117,
-        0x0113, 0x010f, 0x010b, 0x0107, 0x0103, 0x00ff, 0x00fb, 0x00f7, 0x00f3, 0x00ef, 0x00eb,
-        0x00e7, 0x00e3, 0x00df, 0x00db, 0x00d7, 0x00d3, 0x00cf, 0x00cb, 0x00c7, 0x00c3, 0x00bf,
-        0x00bb, 0x00b7, 0x00b3, 0x00af, 0x00ab, 0x00a7, 0x00a3, 0x009f, 0x009b, 0x0097, 0x0093,
-        0x008f, 0x008b, 0x0087, 0x0083, 0x007f, 0x007b, 0x0077, 0x0073, 0x006f, 0x006b, 0x0067,
-        0x0063, 0x005f, 0x005b, 0x0057, 0x0053, 0x004f, 0x004b, 0x0047, 0x0043, 0x003f, 0x003b,
-        0x0037, 0x0033, 0x002f, 0x002b, 0x0027, 0x0023, 0x001f, 0x001b, 0x0017, 0x0013, 0x000f,
-        0x000b, 0x0007, 0x0003, 0x0000, 0xfffd, 0xfff9, 0xfff5, 0xfff1, 0xffed, 0xffe9, 0xffe5,
-        0xffe1, 0xffdd, 0xffd9, 0xffd5, 0xffd1, 0xffcd, 0xffc9, 0xffc5, 0xffc1, 0xffbd, 0xffb9,
-        0xffb5, 0xffb1, 0xffad, 0xffa9, 0xffa5, 0xffa1, 0xff9d, 0xff99, 0xff95, 0xff91, 0xff8d,
-        0xff89, 0xff85, 0xff81, 0xff7d, 0xff79, 0xff75, 0xff71, 0xff6d, 0xff69, 0xff65, 0xff61,
-        0xff5d, 0xff59, 0xff55, 0xff51, 0xff4d, 0xff49, 0xff45, 0xff41, 0xff3d, 0xff39, 0xff35,
-        0xff31, 0xff2d, 0xff29, 0xff25, 0xff21, 0xff1d, 0xff19, 0xff15, 0xff11, 0xff0d, 0xff09,
-        0xff05, 0xff01, 0xfefd, 0xfef9, 0xfef5, 0xfef1, 0xfeed, 0xfee9, 0xfee5, 0xfee1, 0xfedd,
-        0xfed9, 0xfed5, 0xfed1, 0xfecd, 0xfec9, 0xfec5, 0xfec1, 0xfebd, 0xfeb9, 0xfeb5, 0xfeb1,
-        0xfead, 0xfea9, 0xfea5, 0xfea1, 0xfe9d, 0xfe99, 0xfe95, 0xfe91, 0xfe8d, 0xfe89, 0xfe85,
-        0xfe81, 0xfe7d, 0xfe79, 0xfe75, 0xfe71, 0xfe6d, 0xfe69, 0xfe65, 0xfe61, 0xfe5d, 0xfe59,
-        0xfe55, 0xfe51, 0xfe4d, 0xfe49, 0xfe45, 0xfe41, 0xfe3d, 0xfe39, 0xfe35, 0xfe31, 0xfe2d,
-        0xfe29, 0xfe25, 0xfe21, 0xfe1d, 0xfe19, 0xfe15, 0xfe11, 0xfe0d, 0xfe09, 0xfe05, 0xfe01,
-        0xfe05, 0xfe09, 0xfe0d, 0xfe11, 0xfe15, 0xfe19, 0xfe1d, 0xfe21, 0xfe25, 0xfe29, 0xfe2d,
-        0xfe31, 0xfe35, 0xfe39, 0xfe3d, 0xfe41, 0xfe45, 0xfe49, 0xfe4d, 0xfe51, 0xfe55, 0xfe59,
-        0xfe5d, 0xfe61, 0xfe65, 0xfe69, 0xfe6d, 0xfe71, 0xfe75, 0xfe79, 0xfe7d, 0xfe81, 0xfe85,
-        0xfe89, 0xfe8d, 0xfe91, 0xfe95, 0xfe99, 0xfe9d, 0xfea1, 0xfea5, 0xfea9, 0xfead, 0xfeb1,
-        0xfeb5, 0xfeb9, 0xfebd, 0xfec1, 0xfec5, 0xfec9, 0xfecd, 0xfed1, 0xfed5, 0xfed9, 0xfedd,
-        0xfee1, 0xfee5, 0xfee9, 0xfeed, 0xfef1, 0xfef5, 0xfef9, 0xfefd, 0xff01, 0xff05, 0xff09,
-        0xff0d, 0xff11, 0xff15, 0xff19, 0xff1d, 0xff21, 0xff25, 0xff29, 0xff2d, 0xff31, 0xff35,
-        0xff39, 0xff3d, 0xff41, 0xff45, 0xff49, 0xff4d, 0xff51, 0xff55, 0xff59, 0xff5d, 0xff61,
-        0xff65, 0xff69, 0xff6d, 0xff71, 0xff75, 0xff79, 0xff7d, 0xff81, 0xff85, 0xff89, 0xff8d,
-        0xff91, 0xff95, 0xff99, 0xff9d, 0xffa1, 0xffa5, 0xffa9, 0xffad, 0xffb1, 0xffb5, 0xffb9,
-        0xffbd, 0xffc1, 0xffc5, 0xffc9, 0xffcd, 0xffd1, 0xffd5, 0xffd9, 0xffdd, 0xffe1, 0xffe5,
-        0xffe9, 0xffed, 0xfff1, 0xfff5, 0xfff9, 0xfffd,
+        0x01e3, 0x01e7, 0x01eb, 0x01ef, 0x01f3, 0x01f7, 0x01fb, 0x01ff,
     },
     {
         0x0000, 0x0003, 0x0007, 0x000b, 0x000f, 0x0013, 0x0017, 0x001c, 0x0020, 0x0024, 0x0028,
@@ -612,42 +195,7 @@ static const int16_t oscillator_bltriangle[10][512] PROGMEM = {
         0x015f, 0x0163, 0x0167, 0x016b, 0x016f, 0x0173, 0x0177, 0x017b, 0x017f, 0x0183, 0x0187,
         0x018b, 0x018f, 0x0193, 0x0198, 0x019b, 0x019f, 0x01a3, 0x01a7, 0x01ab, 0x01af, 0x01b3,
         0x01b7, 0x01bb, 0x01c0, 0x01c4, 0x01c8, 0x01cb, 0x01cf, 0x01d3, 0x01d7, 0x01db, 0x01df,
-        0x01e3, 0x01e8, 0x01ec, 0x01f0, 0x01f4, 0x01f8, 0x01fb, 0x01fe, 0x01fb, 0x01f8, 0x01f4,
-        0x01f0, 0x01ec, 0x01e8, 0x01e3, 0x01df, 0x01db, 0x01d7, 0x01d3, 0x01cf, 0x01cb, 0x01c8,
-        0x01c4, 0x01c0, 0x01bb, 0x01b7, 0x01b3, 0x01af, 0x01ab, 0x01a7, 0x01a3, 0x019f, 0x019b,
-        0x0198, 0x0193, 0x018f, 0x018b, 0x0187, 0x0183, 0x017f, 0x017b, 0x0177, 0x0173, 0x016f,
-        0x016b, 0x0167, 0x0163, 0x015f, 0x015b, 0x0157, 0x0153, 0x014f, 0x014b, 0x0147, 0x0143,
-        0x013f, 0x013b, 0x0137, 0x0133, 0x012f, 0x012b, 0x0127, 0x0123, 0x011f, 0x011b, 0x0117,
-        0x0113, 0x010f, 0x010b, 0x0107, 0x0103, 0x00ff, 0x00fb, 0x00f7, 0x00f3, 0x00ef, 0x00eb,
-        0x00e7, 0x00e3, 0x00df, 0x00db, 0x00d7, 0x00d3, 0x00cf, 0x00cb, 0x00c7, 0x00c3, 0x00bf,
-        0x00bb, 0x00b7, 0x00b3, 0x00af, 0x00ab, 0x00a7, 0x00a3, 0x009f, 0x009b, 0x0097, 0x0093,
-        0x008f, 0x008b, 0x0087, 0x0083, 0x0080, 0x007c, 0x0077, 0x0073, 0x006f, 0x006b, 0x0067,
-        0x0063, 0x005f, 0x005b, 0x0058, 0x0054, 0x0050, 0x004c, 0x0047, 0x0043, 0x003f, 0x003b,
-        0x0037, 0x0033, 0x002f, 0x002c, 0x0028, 0x0024, 0x0020, 0x001c, 0x0017, 0x0013, 0x000f,
-        0x000b, 0x0007, 0x0003, 0x0000, 0xfffd, 0xfff9, 0xfff5, 0xfff1, 0xffed, 0xffe9, 0xffe4,
-        0xffe0, 0xffdc, 0xffd8, 0xffd4, 0xffd1, 0xffcd, 0xffc9, 0xffc5, 0xffc1, 0xffbd, 0xffb9,
-        0xffb4, 0xffb0, 0xffac, 0xffa8, 0xffa5, 0xffa1, 0xff9d, 0xff99, 0xff95, 0xff91, 0xff8d,
-        0xff89, 0xff84, 0xff80, 0xff7d, 0xff79, 0xff75, 0xff71, 0xff6d, 0xff69, 0xff65, 0xff61,
-        0xff5d, 0xff59, 0xff55, 0xff51, 0xff4d, 0xff49, 0xff45, 0xff41, 0xff3d, 0xff39, 0xff35,
-        0xff31, 0xff2d, 0xff29, 0xff25, 0xff21, 0xff1d, 0xff19, 0xff15, 0xff11, 0xff0d, 0xff09,
-        0xff05, 0xff01, 0xfefd, 0xfef9, 0xfef5, 0xfef1, 0xfeed, 0xfee9, 0xfee5, 0xfee1, 0xfedd,
-        0xfed9, 0xfed5, 0xfed1, 0xfecd, 0xfec9, 0xfec5, 0xfec1, 0xfebd, 0xfeb9, 0xfeb5, 0xfeb1,
-        0xfead, 0xfea9, 0xfea5, 0xfea1, 0xfe9d, 0xfe99, 0xfe95, 0xfe91, 0xfe8d, 0xfe89, 0xfe85,
-        0xfe81, 0xfe7d, 0xfe79, 0xfe75, 0xfe71, 0xfe6d, 0xfe68, 0xfe65, 0xfe61, 0xfe5d, 0xfe59,
-        0xfe55, 0xfe51, 0xfe4d, 0xfe49, 0xfe45, 0xfe40, 0xfe3c, 0xfe38, 0xfe35, 0xfe31, 0xfe2d,
-        0xfe29, 0xfe25, 0xfe21, 0xfe1d, 0xfe18, 0xfe14, 0xfe10, 0xfe0c, 0xfe08, 0xfe05, 0xfe01,
-        0xfe05, 0xfe08, 0xfe0c, 0xfe10, 0xfe14, 0xfe18, 0xfe1d, 0xfe21, 0xfe25, 0xfe29, 0xfe2d,
-        0xfe31, 0xfe35, 0xfe38, 0xfe3c, 0xfe40, 0xfe45, 0xfe49, 0xfe4d, 0xfe51, 0xfe55, 0xfe59,
-        0xfe5d, 0xfe61, 0xfe65, 0xfe68, 0xfe6d, 0xfe71, 0xfe75, 0xfe79, 0xfe7d, 0xfe81, 0xfe85,
-        0xfe89, 0xfe8d, 0xfe91, 0xfe95, 0xfe99, 0xfe9d, 0xfea1, 0xfea5, 0xfea9, 0xfead, 0xfeb1,
-        0xfeb5, 0xfeb9, 0xfebd, 0xfec1, 0xfec5, 0xfec9, 0xfecd, 0xfed1, 0xfed5, 0xfed9, 0xfedd,
-        0xfee1, 0xfee5, 0xfee9, 0xfeed, 0xfef1, 0xfef5, 0xfef9, 0xfefd, 0xff01, 0xff05, 0xff09,
-        0xff0d, 0xff11, 0xff15, 0xff19, 0xff1d, 0xff21, 0xff25, 0xff29, 0xff2d, 0xff31, 0xff35,
-        0xff39, 0xff3d, 0xff41, 0xff45, 0xff49, 0xff4d, 0xff51, 0xff55, 0xff59, 0xff5d, 0xff61,
-        0xff65, 0xff69, 0xff6d, 0xff71, 0xff75, 0xff79, 0xff7d, 0xff80, 0xff84, 0xff89, 0xff8d,
-        0xff91, 0xff95, 0xff99, 0xff9d, 0xffa1, 0xffa5, 0xffa8, 0xffac, 0xffb0, 0xffb4, 0xffb9,
-        0xffbd, 0xffc1, 0xffc5, 0xffc9, 0xffcd, 0xffd1, 0xffd4, 0xffd8, 0xffdc, 0xffe0, 0xffe4,
-        0xffe9, 0xffed, 0xfff1, 0xfff5, 0xfff9, 0xfffd,
+        0x01e3, 0x01e8, 0x01ec, 0x01f0, 0x01f4, 0x01f8, 0x01fb, 0x01fe,
     },
     {
         0x0000, 0x0004, 0x0008, 0x000c, 0x0010, 0x0014, 0x0018, 0x001c, 0x0020, 0x0024, 0x0028,
@@ -661,42 +209,7 @@ static const int16_t oscillator_bltriangle[10][512] PROGMEM = {
         0x0161, 0x0165, 0x0169, 0x016d, 0x0171, 0x0175, 0x0179, 0x017d, 0x0181, 0x0185, 0x018a,
         0x018e, 0x0192, 0x0195, 0x0199, 0x019d, 0x01a1, 0x01a5, 0x01a9, 0x01ad, 0x01b1, 0x01b5,
         0x01b9, 0x01bd, 0x01c1, 0x01c5, 0x01c9, 0x01cd, 0x01d2, 0x01d6, 0x01da, 0x01de, 0x01e3,
-        0x01e7, 0x01eb, 0x01ee, 0x01f2, 0x01f5, 0x01f9, 0x01fc, 0x01fe, 0x01fc, 0x01f9, 0x01f5,
-        0x01f2, 0x01ee, 0x01eb, 0x01e7, 0x01e3, 0x01de, 0x01da, 0x01d6, 0x01d2, 0x01cd, 0x01c9,
-        0x01c5, 0x01c1, 0x01bd, 0x01b9, 0x01b5, 0x01b1, 0x01ad, 0x01a9, 0x01a5, 0x01a1, 0x019d,
-        0x0199, 0x0195, 0x0192, 0x018e, 0x018a, 0x0185, 0x0181, 0x017d, 0x0179, 0x0175, 0x0171,
-        0x016d, 0x0169, 0x0165, 0x0161, 0x015d, 0x0159, 0x0155, 0x0151, 0x014d, 0x0149, 0x0145,
-        0x0141, 0x013d, 0x0139, 0x0135, 0x0131, 0x012d, 0x0129, 0x0125, 0x0121, 0x011d, 0x0119,
-        0x0115, 0x0111, 0x010c, 0x0108, 0x0104, 0x0100, 0x00fc, 0x00f8, 0x00f4, 0x00f0, 0x00ec,
-        0x00e8, 0x00e4, 0x00e1, 0x00dd, 0x00d9, 0x00d5, 0x00d1, 0x00cd, 0x00c8, 0x00c4, 0x00c0,
-        0x00bc, 0x00b8, 0x00b4, 0x00b0, 0x00ac, 0x00a8, 0x00a4, 0x00a0, 0x009c, 0x0098, 0x0094,
-        0x0090, 0x008c, 0x0088, 0x0084, 0x0080, 0x007c, 0x0078, 0x0074, 0x0070, 0x006c, 0x0068,
-        0x0064, 0x0060, 0x005c, 0x0058, 0x0054, 0x0050, 0x004c, 0x0048, 0x0044, 0x0040, 0x003c,
-        0x0038, 0x0034, 0x0030, 0x002c, 0x0028, 0x0024, 0x0020, 0x001c, 0x0018, 0x0014, 0x0010,
-        0x000c, 0x0008, 0x0004, 0x0000, 0xfffc, 0xfff8, 0xfff4, 0xfff0, 0xffec, 0xffe8, 0xffe4,
-        0xffe0, 0xffdc, 0xffd8, 0xffd4, 0xffd0, 0xffcc, 0xffc8, 0xffc4, 0xffc0, 0xffbc, 0xffb8,
-        0xffb4, 0xffb0, 0xffac, 0xffa8, 0xffa4, 0xffa0, 0xff9c, 0xff98, 0xff94, 0xff90, 0xff8c,
-        0xff88, 0xff84, 0xff80, 0xff7c, 0xff78, 0xff74, 0xff70, 0xff6c, 0xff68, 0xff64, 0xff60,
-        0xff5c, 0xff58, 0xff54, 0xff50, 0xff4c, 0xff48, 0xff44, 0xff40, 0xff3c, 0xff38, 0xff33,
-        0xff2f, 0xff2b, 0xff27, 0xff23, 0xff1f, 0xff1c, 0xff18, 0xff14, 0xff10, 0xff0c, 0xff08,
-        0xff04, 0xff00, 0xfefc, 0xfef8, 0xfef4, 0xfeef, 0xfeeb, 0xfee7, 0xfee3, 0xfedf, 0xfedb,
-        0xfed7, 0xfed3, 0xfecf, 0xfecb, 0xfec7, 0xfec3, 0xfebf, 0xfebb, 0xfeb7, 0xfeb3, 0xfeaf,
-        0xfeab, 0xfea7, 0xfea3, 0xfe9f, 0xfe9b, 0xfe97, 0xfe93, 0xfe8f, 0xfe8b, 0xfe87, 0xfe83,
-        0xfe7f, 0xfe7b, 0xfe76, 0xfe72, 0xfe6e, 0xfe6b, 0xfe67, 0xfe63, 0xfe5f, 0xfe5b, 0xfe57,
-        0xfe53, 0xfe4f, 0xfe4b, 0xfe47, 0xfe43, 0xfe3f, 0xfe3b, 0xfe37, 0xfe33, 0xfe2e, 0xfe2a,
-        0xfe26, 0xfe22, 0xfe1d, 0xfe19, 0xfe15, 0xfe12, 0xfe0e, 0xfe0b, 0xfe07, 0xfe04, 0xfe01,
-        0xfe04, 0xfe07, 0xfe0b, 0xfe0e, 0xfe12, 0xfe15, 0xfe19, 0xfe1d, 0xfe22, 0xfe26, 0xfe2a,
-        0xfe2e, 0xfe33, 0xfe37, 0xfe3b, 0xfe3f, 0xfe43, 0xfe47, 0xfe4b, 0xfe4f, 0xfe53, 0xfe57,
-        0xfe5b, 0xfe5f, 0xfe63, 0xfe67, 0xfe6b, 0xfe6e, 0xfe72, 0xfe76, 0xfe7b, 0xfe7f, 0xfe83,
-        0xfe87, 0xfe8b, 0xfe8f, 0xfe93, 0xfe97, 0xfe9b, 0xfe9f, 0xfea3, 0xfea7, 0xfeab, 0xfeaf,
-        0xfeb3, 0xfeb7, 0xfebb, 0xfebf, 0xfec3, 0xfec7, 0xfecb, 0xfecf, 0xfed3, 0xfed7, 0xfedb,
-        0xfedf, 0xfee3, 0xfee7, 0xfeeb, 0xfeef, 0xfef4, 0xfef8, 0xfefc, 0xff00, 0xff04, 0xff08,
-        0xff0c, 0xff10, 0xff14, 0xff18, 0xff1c, 0xff1f, 0xff23, 0xff27, 0xff2b, 0xff2f, 0xff33,
-        0xff38, 0xff3c, 0xff40, 0xff44, 0xff48, 0xff4c, 0xff50, 0xff54, 0xff58, 0xff5c, 0xff60,
-        0xff64, 0xff68, 0xff6c, 0xff70, 0xff74, 0xff78, 0xff7c, 0xff80, 0xff84, 0xff88, 0xff8c,
-        0xff90, 0xff94, 0xff98, 0xff9c, 0xffa0, 0xffa4, 0xffa8, 0xffac, 0xffb0, 0xffb4, 0xffb8,
-        0xffbc, 0xffc0, 0xffc4, 0xffc8, 0xffcc, 0xffd0, 0xffd4, 0xffd8, 0xffdc, 0xffe0, 0xffe4,
-        0xffe8, 0xffec, 0xfff0, 0xfff4, 0xfff8, 0xfffc,
+        0x01e7, 0x01eb, 0x01ee, 0x01f2, 0x01f5, 0x01f9, 0x01fc, 0x01fe,
     },
     {
         0x0000, 0x0003, 0x0007, 0x000b, 0x000f, 0x0013, 0x0017, 0x001b, 0x001f, 0x0023, 0x0027,
@@ -710,42 +223,7 @@ static const int16_t oscillator_bltriangle[10][512] PROGMEM = {
         0x015f, 0x0163, 0x0167, 0x016b, 0x016f, 0x0173, 0x0177, 0x017b, 0x017f, 0x0183, 0x0187,
         0x018b, 0x018f, 0x0193, 0x0197, 0x019b, 0x019f, 0x01a3, 0x01a7, 0x01ab, 0x01af, 0x01b3,
         0x01b7, 0x01bb, 0x01bf, 0x01c3, 0x01c7, 0x01ca, 0x01cf, 0x01d2, 0x01d7, 0x01da, 0x01df,
-        0x01e2, 0x01e7, 0x01ea, 0x01ef, 0x01f2, 0x01f7, 0x01fa, 0x01fe, 0x01fa, 0x01f7, 0x01f2,
-        0x01ef, 0x01ea, 0x01e7, 0x01e2, 0x01df, 0x01da, 0x01d7, 0x01d2, 0x01cf, 0x01ca, 0x01c7,
-        0x01c3, 0x01bf, 0x01bb, 0x01b7, 0x01b3, 0x01af, 0x01ab, 0x01a7, 0x01a3, 0x019f, 0x019b,
-        0x0197, 0x0193, 0x018f, 0x018b, 0x0187, 0x0183, 0x017f, 0x017b, 0x0177, 0x0173, 0x016f,
-        0x016b, 0x0167, 0x0163, 0x015f, 0x015b, 0x0157, 0x0153, 0x014f, 0x014b, 0x0147, 0x0143,
-        0x013f, 0x013b, 0x0137, 0x0133, 0x012f, 0x012b, 0x0127, 0x0123, 0x011f, 0x011b, 0x0117,
-        0x0113, 0x010f, 0x010b, 0x0107, 0x0103, 0x00ff, 0x00fb, 0x00f7, 0x00f3, 0x00ef, 0x00eb,
-        0x00e7, 0x00e3, 0x00df, 0x00db, 0x00d7, 0x00d3, 0x00cf, 0x00cb, 0x00c7, 0x00c3, 0x00bf,
-        0x00bb, 0x00b7, 0x00b3, 0x00af, 0x00ab, 0x00a7, 0x00a3, 0x009f, 0x009b, 0x0097, 0x0093,
-        0x008f, 0x008b, 0x0087, 0x0083, 0x007f, 0x007b, 0x0077, 0x0073, 0x006f, 0x006b, 0x0067,
-        0x0063, 0x005f, 0x005b, 0x0057, 0x0053, 0x004f, 0x004b, 0x0047, 0x0043, 0x003f, 0x003b,
-        0x0037, 0x0033, 0x002f, 0x002b, 0x0027, 0x0023, 0x001f, 0x001b, 0x0017, 0x0013, 0x000f,
-        0x000b, 0x0007, 0x0003, 0x0000, 0xfffd, 0xfff9, 0xfff5, 0xfff1, 0xffed, 0xffe9, 0xffe5,
-        0xffe1, 0xffdd, 0xffd9, 0xffd5, 0xffd1, 0xffcd, 0xffc9, 0xffc5, 0xffc1, 0xffbd, 0xffb9,
-        0xffb5, 0xffb1, 0xffad, 0xffa9, 0xffa5, 0xffa1, 0xff9d, 0xff99, 0xff95, 0xff91, 0xff8d,
-        0xff89, 0xff85, 0xff81, 0xff7d, 0xff79, 0xff75, 0xff71, 0xff6d, 0xff69, 0xff65, 0xff61,
-        0xff5d, 0xff59, 0xff55, 0xff51, 0xff4d, 0xff49, 0xff45, 0xff41, 0xff3d, 0xff39, 0xff35,
-        0xff31, 0xff2d, 0xff29, 0xff25, 0xff21, 0xff1d, 0xff19, 0xff15, 0xff11, 0xff0d, 0xff09,
-        0xff05, 0xff01, 0xfefd, 0xfef9, 0xfef5, 0xfef1, 0xfeed, 0xfee9, 0xfee5, 0xfee1, 0xfedd,
-        0xfed9, 0xfed5, 0xfed1, 0xfecd, 0xfec9, 0xfec5, 0xfec1, 0xfebd, 0xfeb9, 0xfeb5, 0xfeb1,
-        0xfead, 0xfea9, 0xfea5, 0xfea1, 0xfe9d, 0xfe99, 0xfe95, 0xfe91, 0xfe8d, 0xfe89, 0xfe85,
-        0xfe81, 0xfe7d, 0xfe79, 0xfe75, 0xfe71, 0xfe6d, 0xfe69, 0xfe65, 0xfe61, 0xfe5d, 0xfe59,
-        0xfe55, 0xfe51, 0xfe4d, 0xfe49, 0xfe45, 0xfe41, 0xfe3d, 0xfe39, 0xfe36, 0xfe31, 0xfe2e,
-        0xfe29, 0xfe26, 0xfe21, 0xfe1e, 0xfe19, 0xfe16, 0xfe11, 0xfe0e, 0xfe09, 0xfe06, 0xfe01,
-        0xfe06, 0xfe09, 0xfe0e, 0xfe11, 0xfe16, 0xfe19, 0xfe1e, 0xfe21, 0xfe26, 0xfe29, 0xfe2e,
-        0xfe31, 0xfe36, 0xfe39, 0xfe3d, 0xfe41, 0xfe45, 0xfe49, 0xfe4d, 0xfe51, 0xfe55, 0xfe59,
-        0xfe5d, 0xfe61, 0xfe65, 0xfe69, 0xfe6d, 0xfe71, 0xfe75, 0xfe79, 0xfe7d, 0xfe81, 0xfe85,
-        0xfe89, 0xfe8d, 0xfe91, 0xfe95, 0xfe99, 0xfe9d, 0xfea1, 0xfea5, 0xfea9, 0xfead, 0xfeb1,
-        0xfeb5, 0xfeb9, 0xfebd, 0xfec1, 0xfec5, 0xfec9, 0xfecd, 0xfed1, 0xfed5, 0xfed9, 0xfedd,
-        0xfee1, 0xfee5, 0xfee9, 0xfeed, 0xfef1, 0xfef5, 0xfef9, 0xfefd, 0xff01, 0xff05, 0xff09,
-        0xff0d, 0xff11, 0xff15, 0xff19, 0xff1d, 0xff21, 0xff25, 0xff29, 0xff2d, 0xff31, 0xff35,
-        0xff39, 0xff3d, 0xff41, 0xff45, 0xff49, 0xff4d, 0xff51, 0xff55, 0xff59, 0xff5d, 0xff61,
-        0xff65, 0xff69, 0xff6d, 0xff71, 0xff75, 0xff79, 0xff7d, 0xff81, 0xff85, 0xff89, 0xff8d,
-        0xff91, 0xff95, 0xff99, 0xff9d, 0xffa1, 0xffa5, 0xffa9, 0xffad, 0xffb1, 0xffb5, 0xffb9,
-        0xffbd, 0xffc1, 0xffc5, 0xffc9, 0xffcd, 0xffd1, 0xffd5, 0xffd9, 0xffdd, 0xffe1, 0xffe5,
-        0xffe9, 0xffed, 0xfff1, 0xfff5, 0xfff9, 0xfffd,
+        0x01e2, 0x01e7, 0x01ea, 0x01ef, 0x01f2, 0x01f7, 0x01fa, 0x01fe,
     },
     {
         0x0000, 0x0004, 0x0008, 0x000b, 0x0010, 0x0014, 0x0018, 0x001b, 0x0020, 0x0024, 0x0028,
@@ -759,42 +237,7 @@ static const int16_t oscillator_bltriangle[10][512] PROGMEM = {
         0x0160, 0x0164, 0x0168, 0x016c, 0x0170, 0x0174, 0x0178, 0x017c, 0x0180, 0x0184, 0x0188,
         0x018c, 0x0190, 0x0194, 0x0198, 0x019c, 0x01a0, 0x01a4, 0x01a8, 0x01ac, 0x01b0, 0x01b4,
         0x01b8, 0x01bc, 0x01c0, 0x01c4, 0x01c8, 0x01cc, 0x01d0, 0x01d4, 0x01d8, 0x01dc, 0x01e0,
-        0x01e4, 0x01e8, 0x01ec, 0x01f0, 0x01f3, 0x01f8, 0x01fc, 0x01fe, 0x01fc, 0x01f8, 0x01f3,
-        0x01f0, 0x01ec, 0x01e8, 0x01e4, 0x01e0, 0x01dc, 0x01d8, 0x01d4, 0x01d0, 0x01cc, 0x01c8,
-        0x01c4, 0x01c0, 0x01bc, 0x01b8, 0x01b4, 0x01b0, 0x01ac, 0x01a8, 0x01a4, 0x01a0, 0x019c,
-        0x0198, 0x0194, 0x0190, 0x018c, 0x0188, 0x0184, 0x0180, 0x017c, 0x0178, 0x0174, 0x0170,
-        0x016c, 0x0168, 0x0164, 0x0160, 0x015c, 0x0158, 0x0154, 0x0150, 0x014c, 0x0148, 0x0144,
-        0x0140, 0x013c, 0x0138, 0x0134, 0x0130, 0x012c, 0x0128, 0x0124, 0x0120, 0x011c, 0x0118,
-        0x0114, 0x0110, 0x010c, 0x0108, 0x0104, 0x0100, 0x00fc, 0x00f8, 0x00f4, 0x00f0, 0x00ec,
-        0x00e8, 0x00e4, 0x00e0, 0x00dc, 0x00d8, 0x00d4, 0x00d0, 0x00cc, 0x00c8, 0x00c4, 0x00c0,
-        0x00bc, 0x00b8, 0x00b4, 0x00b0, 0x00ac, 0x00a8, 0x00a4, 0x00a0, 0x009c, 0x0098, 0x0094,
-        0x0090, 0x008c, 0x0088, 0x0084, 0x0080, 0x007c, 0x0078, 0x0074, 0x0070, 0x006c, 0x0068,
-        0x0064, 0x0060, 0x005c, 0x0058, 0x0054, 0x0050, 0x004c, 0x0048, 0x0044, 0x0040, 0x003c,
-        0x0038, 0x0034, 0x0030, 0x002c, 0x0028, 0x0024, 0x0020, 0x001b, 0x0018, 0x0014, 0x0010,
-        0x000b, 0x0008, 0x0004, 0x0000, 0xfffc, 0xfff8, 0xfff5, 0xfff0, 0xffec, 0xffe8, 0xffe5,
-        0xffe0, 0xffdc, 0xffd8, 0xffd4, 0xffd0, 0xffcc, 0xffc8, 0xffc4, 0xffc0, 0xffbc, 0xffb8,
-        0xffb4, 0xffb0, 0xffac, 0xffa8, 0xffa4, 0xffa0, 0xff9c, 0xff98, 0xff94, 0xff90, 0xff8c,
-        0xff88, 0xff84, 0xff80, 0xff7c, 0xff78, 0xff74, 0xff70, 0xff6c, 0xff68, 0xff64, 0xff60,
-        0xff5c, 0xff58, 0xff54, 0xff50, 0xff4c, 0xff48, 0xff44, 0xff40, 0xff3c, 0xff38, 0xff34,
-        0xff30, 0xff2c, 0xff28, 0xff24, 0xff20, 0xff1c, 0xff18, 0xff14, 0xff10, 0xff0c, 0xff08,
-        0xff04, 0xff00, 0xfefc, 0xfef8, 0xfef4, 0xfef0, 0xfeec, 0xfee8, 0xfee4, 0xfee0, 0xfedc,
-        0xfed8, 0xfed4, 0xfed0, 0xfecc, 0xfec8, 0xfec4, 0xfec0, 0xfebc, 0xfeb8, 0xfeb4, 0xfeb0,
-        0xfeac, 0xfea8, 0xfea4, 0xfea0, 0xfe9c, 0xfe98, 0xfe94, 0xfe90, 0xfe8c, 0xfe88, 0xfe84,
-        0xfe80, 0xfe7c, 0xfe78, 0xfe74, 0xfe70, 0xfe6c, 0xfe68, 0xfe64, 0xfe60, 0xfe5c, 0xfe58,
-        0xfe54, 0xfe50, 0xfe4c, 0xfe48, 0xfe44, 0xfe40, 0xfe3c, 0xfe38, 0xfe34, 0xfe30, 0xfe2c,
-        0xfe28, 0xfe24, 0xfe20, 0xfe1c, 0xfe18, 0xfe14, 0xfe10, 0xfe0d, 0xfe08, 0xfe04, 0xfe01,
-        0xfe04, 0xfe08, 0xfe0d, 0xfe10, 0xfe14, 0xfe18, 0xfe1c, 0xfe20, 0xfe24, 0xfe28, 0xfe2c,
-        0xfe30, 0xfe34, 0xfe38, 0xfe3c, 0xfe40, 0xfe44, 0xfe48, 0xfe4c, 0xfe50, 0xfe54, 0xfe58,
-        0xfe5c, 0xfe60, 0xfe64, 0xfe68, 0xfe6c, 0xfe70, 0xfe74, 0xfe78, 0xfe7c, 0xfe80, 0xfe84,
-        0xfe88, 0xfe8c, 0xfe90, 0xfe94, 0xfe98, 0xfe9c, 0xfea0, 0xfea4, 0xfea8, 0xfeac, 0xfeb0,
-        0xfeb4, 0xfeb8, 0xfebc, 0xfec0, 0xfec4, 0xfec8, 0xfecc, 0xfed0, 0xfed4, 0xfed8, 0xfedc,
-        0xfee0, 0xfee4, 0xfee8, 0xfeec, 0xfef0, 0xfef4, 0xfef8, 0xfefc, 0xff00, 0xff04, 0xff08,
-        0xff0c, 0xff10, 0xff14, 0xff18, 0xff1c, 0xff20, 0xff24, 0xff28, 0xff2c, 0xff30, 0xff34,
-        0xff38, 0xff3c, 0xff40, 0xff44, 0xff48, 0xff4c, 0xff50, 0xff54, 0xff58, 0xff5c, 0xff60,
-        0xff64, 0xff68, 0xff6c, 0xff70, 0xff74, 0xff78, 0xff7c, 0xff80, 0xff84, 0xff88, 0xff8c,
-        0xff90, 0xff94, 0xff98, 0xff9c, 0xffa0, 0xffa4, 0xffa8, 0xffac, 0xffb0, 0xffb4, 0xffb8,
-        0xffbc, 0xffc0, 0xffc4, 0xffc8, 0xffcc, 0xffd0, 0xffd4, 0xffd8, 0xffdc, 0xffe0, 0xffe5,
-        0xffe8, 0xffec, 0xfff0, 0xfff5, 0xfff8, 0xfffc,
+        0x01e4, 0x01e8, 0x01ec, 0x01f0, 0x01f3, 0x01f8, 0x01fc, 0x01fe,
     },
     {
         0x0000, 0x0004, 0x0008, 0x000c, 0x0010, 0x0014, 0x0018, 0x001c, 0x0020, 0x0024, 0x0028,
@@ -808,42 +251,7 @@ static const int16_t oscillator_bltriangle[10][512] PROGMEM = {
         0x0161, 0x0165, 0x0169, 0x016d, 0x0171, 0x0175, 0x0179, 0x017d, 0x0181, 0x0185, 0x0189,
         0x018d, 0x0191, 0x0195, 0x0199, 0x019d, 0x01a1, 0x01a5, 0x01a9, 0x01ad, 0x01b1, 0x01b5,
         0x01b9, 0x01bd, 0x01c1, 0x01c5, 0x01c9, 0x01cd, 0x01d1, 0x01d6, 0x01da, 0x01de, 0x01e1,
-        0x01e5, 0x01e9, 0x01ed, 0x01f2, 0x01f6, 0x01fb, 0x01fd, 0x01fe, 0x01fd, 0x01fb, 0x01f6,
-        0x01f2, 0x01ed, 0x01e9, 0x01e5, 0x01e1, 0x01de, 0x01da, 0x01d6, 0x01d1, 0x01cd, 0x01c9,
-        0x01c5, 0x01c1, 0x01bd, 0x01b9, 0x01b5, 0x01b1, 0x01ad, 0x01a9, 0x01a5, 0x01a1, 0x019d,
-        0x0199, 0x0195, 0x0191, 0x018d, 0x0189, 0x0185, 0x0181, 0x017d, 0x0179, 0x0175, 0x0171,
-        0x016d, 0x0169, 0x0165, 0x0161, 0x015d, 0x0159, 0x0155, 0x0151, 0x014d, 0x0149, 0x0145,
-        0x0141, 0x013d, 0x0139, 0x0135, 0x0131, 0x012d, 0x0129, 0x0125, 0x0121, 0x011d, 0x0119,
-        0x0115, 0x0110, 0x010c, 0x0109, 0x0105, 0x0101, 0x00fd, 0x00f8, 0x00f4, 0x00f0, 0x00ec,
-        0x00e8, 0x00e4, 0x00e0, 0x00dc, 0x00d8, 0x00d4, 0x00d0, 0x00cc, 0x00c8, 0x00c4, 0x00c0,
-        0x00bc, 0x00b8, 0x00b4, 0x00b0, 0x00ac, 0x00a8, 0x00a4, 0x00a0, 0x009c, 0x0098, 0x0094,
-        0x0090, 0x008c, 0x0088, 0x0084, 0x0080, 0x007c, 0x0078, 0x0074, 0x0070, 0x006c, 0x0068,
-        0x0064, 0x0060, 0x005c, 0x0058, 0x0054, 0x0050, 0x004c, 0x0048, 0x0044, 0x0040, 0x003c,
-        0x0038, 0x0034, 0x0030, 0x002c, 0x0028, 0x0024, 0x0020, 0x001c, 0x0018, 0x0014, 0x0010,
-        0x000c, 0x0008, 0x0004, 0x0000, 0xfffc, 0xfff8, 0xfff4, 0xfff0, 0xffec, 0xffe8, 0xffe4,
-        0xffe0, 0xffdc, 0xffd8, 0xffd4, 0xffd0, 0xffcc, 0xffc8, 0xffc4, 0xffc0, 0xffbc, 0xffb8,
-        0xffb4, 0xffb0, 0xffac, 0xffa8, 0xffa4, 0xffa0, 0xff9c, 0xff98, 0xff94, 0xff90, 0xff8c,
-        0xff88, 0xff84, 0xff80, 0xff7c, 0xff78, 0xff74, 0xff70, 0xff6c, 0xff68, 0xff64, 0xff60,
-        0xff5c, 0xff58, 0xff54, 0xff50, 0xff4c, 0xff48, 0xff44, 0xff40, 0xff3c, 0xff38, 0xff34,
-        0xff30, 0xff2c, 0xff28, 0xff24, 0xff20, 0xff1c, 0xff18, 0xff14, 0xff10, 0xff0c, 0xff08,
-        0xff03, 0xfeff, 0xfefb, 0xfef7, 0xfef4, 0xfef0, 0xfeeb, 0xfee7, 0xfee3, 0xfedf, 0xfedb,
-        0xfed7, 0xfed3, 0xfecf, 0xfecb, 0xfec7, 0xfec3, 0xfebf, 0xfebb, 0xfeb7, 0xfeb3, 0xfeaf,
-        0xfeab, 0xfea7, 0xfea3, 0xfe9f, 0xfe9b, 0xfe97, 0xfe93, 0xfe8f, 0xfe8b, 0xfe87, 0xfe83,
-        0xfe7f, 0xfe7b, 0xfe77, 0xfe73, 0xfe6f, 0xfe6b, 0xfe67, 0xfe63, 0xfe5f, 0xfe5b, 0xfe57,
-        0xfe53, 0xfe4f, 0xfe4b, 0xfe47, 0xfe43, 0xfe3f, 0xfe3b, 0xfe37, 0xfe33, 0xfe2f, 0xfe2a,
-        0xfe26, 0xfe22, 0xfe1f, 0xfe1b, 0xfe17, 0xfe13, 0xfe0e, 0xfe0a, 0xfe05, 0xfe03, 0xfe01,
-        0xfe03, 0xfe05, 0xfe0a, 0xfe0e, 0xfe13, 0xfe17, 0xfe1b, 0xfe1f, 0xfe22, 0xfe26, 0xfe2a,
-        0xfe2f, 0xfe33, 0xfe37, 0xfe3b, 0xfe3f, 0xfe43, 0xfe47, 0xfe4b, 0xfe4f, 0xfe53, 0xfe57,
-        0xfe5b, 0xfe5f, 0xfe63, 0xfe67, 0xfe6b, 0xfe6f, 0xfe73, 0xfe77, 0xfe7b, 0xfe7f, 0xfe83,
-        0xfe87, 0xfe8b, 0xfe8f, 0xfe93, 0xfe97, 0xfe9b, 0xfe9f, 0xfea3, 0xfea7, 0xfeab, 0xfeaf,
-        0xfeb3, 0xfeb7, 0xfebb, 0xfebf, 0xfec3, 0xfec7, 0xfecb, 0xfecf, 0xfed3, 0xfed7, 0xfedb,
-        0xfedf, 0xfee3, 0xfee7, 0xfeeb, 0xfef0, 0xfef4, 0xfef7, 0xfefb, 0xfeff, 0xff03, 0xff08,
-        0xff0c, 0xff10, 0xff14, 0xff18, 0xff1c, 0xff20, 0xff24, 0xff28, 0xff2c, 0xff30, 0xff34,
-        0xff38, 0xff3c, 0xff40, 0xff44, 0xff48, 0xff4c, 0xff50, 0xff54, 0xff58, 0xff5c, 0xff60,
-        0xff64, 0xff68, 0xff6c, 0xff70, 0xff74, 0xff78, 0xff7c, 0xff80, 0xff84, 0xff88, 0xff8c,
-        0xff90, 0xff94, 0xff98, 0xff9c, 0xffa0, 0xffa4, 0xffa8, 0xffac, 0xffb0, 0xffb4, 0xffb8,
-        0xffbc, 0xffc0, 0xffc4, 0xffc8, 0xffcc, 0xffd0, 0xffd4, 0xffd8, 0xffdc, 0xffe0, 0xffe4,
-        0xffe8, 0xffec, 0xfff0, 0xfff4, 0xfff8, 0xfffc,
+        0x01e5, 0x01e9, 0x01ed, 0x01f2, 0x01f6, 0x01fb, 0x01fd, 0x01fe,
     },
     {
         0x0000, 0x0003, 0x0007, 0x000b, 0x000f, 0x0014, 0x0018, 0x001c, 0x0020, 0x0024, 0x0028,
@@ -857,42 +265,7 @@ static const int16_t oscillator_bltriangle[10][512] PROGMEM = {
         0x0163, 0x0168, 0x016c, 0x0170, 0x0174, 0x0178, 0x017c, 0x0180, 0x0184, 0x0187, 0x018b,
         0x018f, 0x0193, 0x0197, 0x019b, 0x01a0, 0x01a4, 0x01a8, 0x01ad, 0x01b1, 0x01b5, 0x01b9,
         0x01bd, 0x01c0, 0x01c4, 0x01c8, 0x01cb, 0x01cf, 0x01d3, 0x01d8, 0x01dc, 0x01e1, 0x01e5,
-        0x01ea, 0x01ef, 0x01f3, 0x01f7, 0x01fa, 0x01fd, 0x01fe, 0x01fe, 0x01fe, 0x01fd, 0x01fa,
-        0x01f7, 0x01f3, 0x01ef, 0x01ea, 0x01e5, 0x01e1, 0x01dc, 0x01d8, 0x01d3, 0x01cf, 0x01cb,
-        0x01c8, 0x01c4, 0x01c0, 0x01bd, 0x01b9, 0x01b5, 0x01b1, 0x01ad, 0x01a8, 0x01a4, 0x01a0,
-        0x019b, 0x0197, 0x0193, 0x018f, 0x018b, 0x0187, 0x0184, 0x0180, 0x017c, 0x0178, 0x0174,
-        0x0170, 0x016c, 0x0168, 0x0163, 0x015f, 0x015b, 0x0157, 0x0153, 0x014f, 0x014b, 0x0147,
-        0x0143, 0x013f, 0x013b, 0x0137, 0x0133, 0x012f, 0x012b, 0x0127, 0x0123, 0x011e, 0x011a,
-        0x0116, 0x0112, 0x010e, 0x010a, 0x0106, 0x0102, 0x00fe, 0x00fa, 0x00f6, 0x00f2, 0x00ee,
-        0x00ea, 0x00e6, 0x00e2, 0x00de, 0x00da, 0x00d6, 0x00d1, 0x00cd, 0x00c9, 0x00c5, 0x00c2,
-        0x00be, 0x00ba, 0x00b6, 0x00b2, 0x00ae, 0x00a9, 0x00a5, 0x00a1, 0x009d, 0x0099, 0x0095,
-        0x0091, 0x008d, 0x0089, 0x0085, 0x0081, 0x007d, 0x0079, 0x0075, 0x0071, 0x006d, 0x0069,
-        0x0065, 0x0061, 0x005c, 0x0058, 0x0054, 0x0050, 0x004c, 0x0048, 0x0044, 0x0040, 0x003c,
-        0x0038, 0x0034, 0x0030, 0x002c, 0x0028, 0x0024, 0x0020, 0x001c, 0x0018, 0x0014, 0x000f,
-        0x000b, 0x0007, 0x0003, 0x0000, 0xfffd, 0xfff9, 0xfff5, 0xfff1, 0xffec, 0xffe8, 0xffe4,
-        0xffe0, 0xffdc, 0xffd8, 0xffd4, 0xffd0, 0xffcc, 0xffc8, 0xffc4, 0xffc0, 0xffbc, 0xffb8,
-        0xffb4, 0xffb0, 0xffac, 0xffa8, 0xffa4, 0xff9f, 0xff9b, 0xff97, 0xff93, 0xff8f, 0xff8b,
-        0xff87, 0xff83, 0xff7f, 0xff7b, 0xff77, 0xff73, 0xff6f, 0xff6b, 0xff67, 0xff63, 0xff5f,
-        0xff5b, 0xff57, 0xff52, 0xff4e, 0xff4a, 0xff46, 0xff42, 0xff3e, 0xff3b, 0xff37, 0xff33,
-        0xff2f, 0xff2a, 0xff26, 0xff22, 0xff1e, 0xff1a, 0xff16, 0xff12, 0xff0e, 0xff0a, 0xff06,
-        0xff02, 0xfefe, 0xfefa, 0xfef6, 0xfef2, 0xfeee, 0xfeea, 0xfee6, 0xfee2, 0xfedd, 0xfed9,
-        0xfed5, 0xfed1, 0xfecd, 0xfec9, 0xfec5, 0xfec1, 0xfebd, 0xfeb9, 0xfeb5, 0xfeb1, 0xfead,
-        0xfea9, 0xfea5, 0xfea1, 0xfe9d, 0xfe98, 0xfe94, 0xfe90, 0xfe8c, 0xfe88, 0xfe84, 0xfe80,
-        0xfe7c, 0xfe79, 0xfe75, 0xfe71, 0xfe6d, 0xfe69, 0xfe65, 0xfe60, 0xfe5c, 0xfe58, 0xfe53,
-        0xfe4f, 0xfe4b, 0xfe47, 0xfe43, 0xfe40, 0xfe3c, 0xfe38, 0xfe35, 0xfe31, 0xfe2d, 0xfe28,
-        0xfe24, 0xfe1f, 0xfe1b, 0xfe16, 0xfe11, 0xfe0d, 0xfe09, 0xfe06, 0xfe03, 0xfe02, 0xfe01,
-        0xfe02, 0xfe03, 0xfe06, 0xfe09, 0xfe0d, 0xfe11, 0xfe16, 0xfe1b, 0xfe1f, 0xfe24, 0xfe28,
-        0xfe2d, 0xfe31, 0xfe35, 0xfe38, 0xfe3c, 0xfe40, 0xfe43, 0xfe47, 0xfe4b, 0xfe4f, 0xfe53,
-        0xfe58, 0xfe5c, 0xfe60, 0xfe65, 0xfe69, 0xfe6d, 0xfe71, 0xfe75, 0xfe79, 0xfe7c, 0xfe80,
-        0xfe84, 0xfe88, 0xfe8c, 0xfe90, 0xfe94, 0xfe98, 0xfe9d, 0xfea1, 0xfea5, 0xfea9, 0xfead,
-        0xfeb1, 0xfeb5, 0xfeb9, 0xfebd, 0xfec1, 0xfec5, 0xfec9, 0xfecd, 0xfed1, 0xfed5, 0xfed9,
-        0xfedd, 0xfee2, 0xfee6, 0xfeea, 0xfeee, 0xfef2, 0xfef6, 0xfefa, 0xfefe, 0xff02, 0xff06,
-        0xff0a, 0xff0e, 0xff12, 0xff16, 0xff1a, 0xff1e, 0xff22, 0xff26, 0xff2a, 0xff2f, 0xff33,
-        0xff37, 0xff3b, 0xff3e, 0xff42, 0xff46, 0xff4a, 0xff4e, 0xff52, 0xff57, 0xff5b, 0xff5f,
-        0xff63, 0xff67, 0xff6b, 0xff6f, 0xff73, 0xff77, 0xff7b, 0xff7f, 0xff83, 0xff87, 0xff8b,
-        0xff8f, 0xff93, 0xff97, 0xff9b, 0xff9f, 0xffa4, 0xffa8, 0xffac, 0xffb0, 0xffb4, 0xffb8,
-        0xffbc, 0xffc0, 0xffc4, 0xffc8, 0xffcc, 0xffd0, 0xffd4, 0xffd8, 0xffdc, 0xffe0, 0xffe4,
-        0xffe8, 0xffec, 0xfff1, 0xfff5, 0xfff9, 0xfffd,
+        0x01ea, 0x01ef, 0x01f3, 0x01f7, 0x01fa, 0x01fd, 0x01fe, 0x01fe,
     },
     {
         0x0000, 0x0003, 0x0007, 0x000b, 0x000f, 0x0013, 0x0017, 0x001b, 0x001f, 0x0024, 0x0028,
@@ -906,42 +279,7 @@ static const int16_t oscillator_bltriangle[10][512] PROGMEM = {
         0x016a, 0x016e, 0x0172, 0x0175, 0x0179, 0x017d, 0x0181, 0x0184, 0x0188, 0x018c, 0x0190,
         0x0193, 0x0197, 0x019b, 0x019f, 0x01a3, 0x01a7, 0x01ab, 0x01b0, 0x01b4, 0x01b9, 0x01bd,
         0x01c2, 0x01c7, 0x01cc, 0x01d1, 0x01d5, 0x01da, 0x01df, 0x01e3, 0x01e7, 0x01eb, 0x01ef,
-        0x01f3, 0x01f6, 0x01f8, 0x01fa, 0x01fc, 0x01fd, 0x01fe, 0x01ff, 0x01fe, 0x01fd, 0x01fc,
-        0x01fa, 0x01f8, 0x01f6, 0x01f3, 0x01ef, 0x01eb, 0x01e7, 0x01e3, 0x01df, 0x01da, 0x01d5,
-        0x01d1, 0x01cc, 0x01c7, 0x01c2, 0x01bd, 0x01b9, 0x01b4, 0x01b0, 0x01ab, 0x01a7, 0x01a3,
-        0x019f, 0x019b, 0x0197, 0x0193, 0x0190, 0x018c, 0x0188, 0x0184, 0x0181, 0x017d, 0x0179,
-        0x0175, 0x0172, 0x016e, 0x016a, 0x0165, 0x0161, 0x015d, 0x0159, 0x0154, 0x0150, 0x014c,
-        0x0147, 0x0143, 0x013f, 0x013a, 0x0136, 0x0132, 0x012d, 0x0129, 0x0125, 0x0121, 0x011d,
-        0x0119, 0x0115, 0x0111, 0x010d, 0x0109, 0x0105, 0x0102, 0x00fe, 0x00fa, 0x00f6, 0x00f2,
-        0x00ee, 0x00ea, 0x00e6, 0x00e2, 0x00de, 0x00d9, 0x00d5, 0x00d1, 0x00cd, 0x00c8, 0x00c4,
-        0x00c0, 0x00bc, 0x00b7, 0x00b3, 0x00af, 0x00ab, 0x00a7, 0x00a2, 0x009e, 0x009a, 0x0096,
-        0x0092, 0x008e, 0x008a, 0x0086, 0x0083, 0x007f, 0x007b, 0x0077, 0x0073, 0x006f, 0x006b,
-        0x0067, 0x0063, 0x005f, 0x005a, 0x0056, 0x0052, 0x004e, 0x004a, 0x0045, 0x0041, 0x003d,
-        0x0039, 0x0034, 0x0030, 0x002c, 0x0028, 0x0024, 0x001f, 0x001b, 0x0017, 0x0013, 0x000f,
-        0x000b, 0x0007, 0x0003, 0x0000, 0xfffd, 0xfff9, 0xfff5, 0xfff1, 0xffed, 0xffe9, 0xffe5,
-        0xffe1, 0xffdc, 0xffd8, 0xffd4, 0xffd0, 0xffcc, 0xffc7, 0xffc3, 0xffbf, 0xffbb, 0xffb6,
-        0xffb2, 0xffae, 0xffaa, 0xffa6, 0xffa1, 0xff9d, 0xff99, 0xff95, 0xff91, 0xff8d, 0xff89,
-        0xff85, 0xff81, 0xff7d, 0xff7a, 0xff76, 0xff72, 0xff6e, 0xff6a, 0xff66, 0xff62, 0xff5e,
-        0xff59, 0xff55, 0xff51, 0xff4d, 0xff49, 0xff44, 0xff40, 0xff3c, 0xff38, 0xff33, 0xff2f,
-        0xff2b, 0xff27, 0xff22, 0xff1e, 0xff1a, 0xff16, 0xff12, 0xff0e, 0xff0a, 0xff06, 0xff02,
-        0xfefe, 0xfefb, 0xfef7, 0xfef3, 0xfeef, 0xfeeb, 0xfee7, 0xfee3, 0xfedf, 0xfedb, 0xfed7,
-        0xfed3, 0xfece, 0xfeca, 0xfec6, 0xfec1, 0xfebd, 0xfeb9, 0xfeb4, 0xfeb0, 0xfeac, 0xfea7,
-        0xfea3, 0xfe9f, 0xfe9b, 0xfe96, 0xfe92, 0xfe8e, 0xfe8b, 0xfe87, 0xfe83, 0xfe7f, 0xfe7c,
-        0xfe78, 0xfe74, 0xfe70, 0xfe6d, 0xfe69, 0xfe65, 0xfe61, 0xfe5d, 0xfe59, 0xfe55, 0xfe50,
-        0xfe4c, 0xfe47, 0xfe43, 0xfe3e, 0xfe39, 0xfe34, 0xfe2f, 0xfe2b, 0xfe26, 0xfe21, 0xfe1d,
-        0xfe19, 0xfe15, 0xfe11, 0xfe0d, 0xfe0a, 0xfe08, 0xfe06, 0xfe04, 0xfe03, 0xfe02, 0xfe01,
-        0xfe02, 0xfe03, 0xfe04, 0xfe06, 0xfe08, 0xfe0a, 0xfe0d, 0xfe11, 0xfe15, 0xfe19, 0xfe1d,
-        0xfe21, 0xfe26, 0xfe2b, 0xfe2f, 0xfe34, 0xfe39, 0xfe3e, 0xfe43, 0xfe47, 0xfe4c, 0xfe50,
-        0xfe55, 0xfe59, 0xfe5d, 0xfe61, 0xfe65, 0xfe69, 0xfe6d, 0xfe70, 0xfe74, 0xfe78, 0xfe7c,
-        0xfe7f, 0xfe83, 0xfe87, 0xfe8b, 0xfe8e, 0xfe92, 0xfe96, 0xfe9b, 0xfe9f, 0xfea3, 0xfea7,
-        0xfeac, 0xfeb0, 0xfeb4, 0xfeb9, 0xfebd, 0xfec1, 0xfec6, 0xfeca, 0xfece, 0xfed3, 0xfed7,
-        0xfedb, 0xfedf, 0xfee3, 0xfee7, 0xfeeb, 0xfeef, 0xfef3, 0xfef7, 0xfefb, 0xfefe, 0xff02,
-        0xff06, 0xff0a, 0xff0e, 0xff12, 0xff16, 0xff1a, 0xff1e, 0xff22, 0xff27, 0xff2b, 0xff2f,
-        0xff33, 0xff38, 0xff3c, 0xff40, 0xff44, 0xff49, 0xff4d, 0xff51, 0xff55, 0xff59, 0xff5e,
-        0xff62, 0xff66, 0xff6a, 0xff6e, 0xff72, 0xff76, 0xff7a, 0xff7d, 0xff81, 0xff85, 0xff89,
-        0xff8d, 0xff91, 0xff95, 0xff99, 0xff9d, 0xffa1, 0xffa6, 0xffaa, 0xffae, 0xffb2, 0xffb6,
-        0xffbb, 0xffbf, 0xffc3, 0xffc7, 0xffcc, 0xffd0, 0xffd4, 0xffd8, 0xffdc, 0xffe1, 0xffe5,
-        0xffe9, 0xffed, 0xfff1, 0xfff5, 0xfff9, 0xfffd,
+        0x01f3, 0x01f6, 0x01f8, 0x01fa, 0x01fc, 0x01fd, 0x01fe, 0x01ff,
     },
     {
         0x0000, 0x0003, 0x0007, 0x000b, 0x000f, 0x0013, 0x0017, 0x001b, 0x001f, 0x0023, 0x0027,
@@ -955,42 +293,7 @@ static const int16_t oscillator_bltriangle[10][512] PROGMEM = {
         0x016f, 0x0174, 0x0179, 0x017d, 0x0182, 0x0187, 0x018c, 0x0191, 0x0196, 0x019b, 0x01a0,
         0x01a5, 0x01aa, 0x01af, 0x01b4, 0x01b8, 0x01bd, 0x01c2, 0x01c6, 0x01cb, 0x01cf, 0x01d3,
         0x01d7, 0x01db, 0x01df, 0x01e3, 0x01e6, 0x01e9, 0x01ec, 0x01ef, 0x01f2, 0x01f4, 0x01f6,
-        0x01f8, 0x01fa, 0x01fb, 0x01fc, 0x01fd, 0x01fe, 0x01fe, 0x01ff, 0x01fe, 0x01fe, 0x01fd,
-        0x01fc, 0x01fb, 0x01fa, 0x01f8, 0x01f6, 0x01f4, 0x01f2, 0x01ef, 0x01ec, 0x01e9, 0x01e6,
-        0x01e3, 0x01df, 0x01db, 0x01d7, 0x01d3, 0x01cf, 0x01cb, 0x01c6, 0x01c2, 0x01bd, 0x01b8,
-        0x01b4, 0x01af, 0x01aa, 0x01a5, 0x01a0, 0x019b, 0x0196, 0x0191, 0x018c, 0x0187, 0x0182,
-        0x017d, 0x0179, 0x0174, 0x016f, 0x016a, 0x0165, 0x0161, 0x015c, 0x0158, 0x0153, 0x014f,
-        0x014b, 0x0146, 0x0142, 0x013e, 0x013a, 0x0136, 0x0132, 0x012e, 0x012a, 0x0126, 0x0122,
-        0x011e, 0x011b, 0x0117, 0x0113, 0x010f, 0x010c, 0x0108, 0x0104, 0x0100, 0x00fd, 0x00f9,
-        0x00f5, 0x00f1, 0x00ed, 0x00e9, 0x00e5, 0x00e1, 0x00dd, 0x00d9, 0x00d5, 0x00d1, 0x00cd,
-        0x00c9, 0x00c5, 0x00c0, 0x00bc, 0x00b8, 0x00b3, 0x00af, 0x00ab, 0x00a6, 0x00a2, 0x009d,
-        0x0099, 0x0094, 0x008f, 0x008b, 0x0086, 0x0082, 0x007d, 0x0079, 0x0074, 0x0070, 0x006b,
-        0x0067, 0x0062, 0x005e, 0x0059, 0x0055, 0x0051, 0x004c, 0x0048, 0x0044, 0x003f, 0x003b,
-        0x0037, 0x0033, 0x002f, 0x002b, 0x0027, 0x0023, 0x001f, 0x001b, 0x0017, 0x0013, 0x000f,
-        0x000b, 0x0007, 0x0003, 0x0000, 0xfffd, 0xfff9, 0xfff5, 0xfff1, 0xffed, 0xffe9, 0xffe5,
-        0xffe1, 0xffdd, 0xffd9, 0xffd5, 0xffd1, 0xffcd, 0xffc9, 0xffc5, 0xffc1, 0xffbc, 0xffb8,
-        0xffb4, 0xffaf, 0xffab, 0xffa7, 0xffa2, 0xff9e, 0xff99, 0xff95, 0xff90, 0xff8c, 0xff87,
-        0xff83, 0xff7e, 0xff7a, 0xff75, 0xff71, 0xff6c, 0xff67, 0xff63, 0xff5e, 0xff5a, 0xff55,
-        0xff51, 0xff4d, 0xff48, 0xff44, 0xff40, 0xff3b, 0xff37, 0xff33, 0xff2f, 0xff2b, 0xff27,
-        0xff23, 0xff1f, 0xff1b, 0xff17, 0xff13, 0xff0f, 0xff0b, 0xff07, 0xff03, 0xff00, 0xfefc,
-        0xfef8, 0xfef4, 0xfef1, 0xfeed, 0xfee9, 0xfee5, 0xfee2, 0xfede, 0xfeda, 0xfed6, 0xfed2,
-        0xfece, 0xfeca, 0xfec6, 0xfec2, 0xfebe, 0xfeba, 0xfeb5, 0xfeb1, 0xfead, 0xfea8, 0xfea4,
-        0xfe9f, 0xfe9b, 0xfe96, 0xfe91, 0xfe8c, 0xfe87, 0xfe83, 0xfe7e, 0xfe79, 0xfe74, 0xfe6f,
-        0xfe6a, 0xfe65, 0xfe60, 0xfe5b, 0xfe56, 0xfe51, 0xfe4c, 0xfe48, 0xfe43, 0xfe3e, 0xfe3a,
-        0xfe35, 0xfe31, 0xfe2d, 0xfe29, 0xfe25, 0xfe21, 0xfe1d, 0xfe1a, 0xfe17, 0xfe14, 0xfe11,
-        0xfe0e, 0xfe0c, 0xfe0a, 0xfe08, 0xfe06, 0xfe05, 0xfe04, 0xfe03, 0xfe02, 0xfe02, 0xfe01,
-        0xfe02, 0xfe02, 0xfe03, 0xfe04, 0xfe05, 0xfe06, 0xfe08, 0xfe0a, 0xfe0c, 0xfe0e, 0xfe11,
-        0xfe14, 0xfe17, 0xfe1a, 0xfe1d, 0xfe21, 0xfe25, 0xfe29, 0xfe2d, 0xfe31, 0xfe35, 0xfe3a,
-        0xfe3e, 0xfe43, 0xfe48, 0xfe4c, 0xfe51, 0xfe56, 0xfe5b, 0xfe60, 0xfe65, 0xfe6a, 0xfe6f,
-        0xfe74, 0xfe79, 0xfe7e, 0xfe83, 0xfe87, 0xfe8c, 0xfe91, 0xfe96, 0xfe9b, 0xfe9f, 0xfea4,
-        0xfea8, 0xfead, 0xfeb1, 0xfeb5, 0xfeba, 0xfebe, 0xfec2, 0xfec6, 0xfeca, 0xfece, 0xfed2,
-        0xfed6, 0xfeda, 0xfede, 0xfee2, 0xfee5, 0xfee9, 0xfeed, 0xfef1, 0xfef4, 0xfef8, 0xfefc,
-        0xff00, 0xff03, 0xff07, 0xff0b, 0xff0f, 0xff13, 0xff17, 0xff1b, 0xff1f, 0xff23, 0xff27,
-        0xff2b, 0xff2f, 0xff33, 0xff37, 0xff3b, 0xff40, 0xff44, 0xff48, 0xff4d, 0xff51, 0xff55,
-        0xff5a, 0xff5e, 0xff63, 0xff67, 0xff6c, 0xff71, 0xff75, 0xff7a, 0xff7e, 0xff83, 0xff87,
-        0xff8c, 0xff90, 0xff95, 0xff99, 0xff9e, 0xffa2, 0xffa7, 0xffab, 0xffaf, 0xffb4, 0xffb8,
-        0xffbc, 0xffc1, 0xffc5, 0xffc9, 0xffcd, 0xffd1, 0xffd5, 0xffd9, 0xffdd, 0xffe1, 0xffe5,
-        0xffe9, 0xffed, 0xfff1, 0xfff5, 0xfff9, 0xfffd,
+        0x01f8, 0x01fa, 0x01fb, 0x01fc, 0x01fd, 0x01fe, 0x01fe, 0x01ff,
     },
     {
         0x0000, 0x0003, 0x0007, 0x000b, 0x000f, 0x0012, 0x0016, 0x001a, 0x001e, 0x0022, 0x0025,
@@ -1004,48 +307,13 @@ static const int16_t oscillator_bltriangle[10][512] PROGMEM = {
         0x019a, 0x019f, 0x01a3, 0x01a7, 0x01ac, 0x01b0, 0x01b4, 0x01b8, 0x01bc, 0x01c0, 0x01c4,
         0x01c7, 0x01cb, 0x01ce, 0x01d2, 0x01d5, 0x01d8, 0x01db, 0x01de, 0x01e1, 0x01e3, 0x01e6,
         0x01e9, 0x01eb, 0x01ed, 0x01ef, 0x01f1, 0x01f3, 0x01f5, 0x01f6, 0x01f8, 0x01f9, 0x01fa,
-        0x01fb, 0x01fc, 0x01fd, 0x01fd, 0x01fe, 0x01fe, 0x01fe, 0x01ff, 0x01fe, 0x01fe, 0x01fe,
-        0x01fd, 0x01fd, 0x01fc, 0x01fb, 0x01fa, 0x01f9, 0x01f8, 0x01f6, 0x01f5, 0x01f3, 0x01f1,
-        0x01ef, 0x01ed, 0x01eb, 0x01e9, 0x01e6, 0x01e3, 0x01e1, 0x01de, 0x01db, 0x01d8, 0x01d5,
-        0x01d2, 0x01ce, 0x01cb, 0x01c7, 0x01c4, 0x01c0, 0x01bc, 0x01b8, 0x01b4, 0x01b0, 0x01ac,
-        0x01a7, 0x01a3, 0x019f, 0x019a, 0x0196, 0x0191, 0x018c, 0x0187, 0x0183, 0x017e, 0x0179,
-        0x0174, 0x016f, 0x016a, 0x0165, 0x0160, 0x015b, 0x0155, 0x0150, 0x014b, 0x0146, 0x0140,
-        0x013b, 0x0136, 0x0131, 0x012b, 0x0126, 0x0121, 0x011b, 0x0116, 0x0111, 0x010b, 0x0106,
-        0x0101, 0x00fb, 0x00f6, 0x00f1, 0x00ec, 0x00e7, 0x00e1, 0x00dc, 0x00d7, 0x00d2, 0x00cd,
-        0x00c8, 0x00c3, 0x00be, 0x00b9, 0x00b4, 0x00af, 0x00aa, 0x00a5, 0x00a1, 0x009c, 0x0097,
-        0x0093, 0x008e, 0x0089, 0x0085, 0x0080, 0x007c, 0x0077, 0x0073, 0x006f, 0x006a, 0x0066,
-        0x0062, 0x005d, 0x0059, 0x0055, 0x0051, 0x004d, 0x0049, 0x0045, 0x0041, 0x003d, 0x0039,
-        0x0035, 0x0031, 0x002d, 0x0029, 0x0025, 0x0022, 0x001e, 0x001a, 0x0016, 0x0012, 0x000f,
-        0x000b, 0x0007, 0x0003, 0x0000, 0xfffd, 0xfff9, 0xfff5, 0xfff1, 0xffee, 0xffea, 0xffe6,
-        0xffe2, 0xffde, 0xffdb, 0xffd7, 0xffd3, 0xffcf, 0xffcb, 0xffc7, 0xffc3, 0xffbf, 0xffbb,
-        0xffb7, 0xffb3, 0xffaf, 0xffab, 0xffa7, 0xffa3, 0xff9e, 0xff9a, 0xff96, 0xff91, 0xff8d,
-        0xff89, 0xff84, 0xff80, 0xff7b, 0xff77, 0xff72, 0xff6d, 0xff69, 0xff64, 0xff5f, 0xff5b,
-        0xff56, 0xff51, 0xff4c, 0xff47, 0xff42, 0xff3d, 0xff38, 0xff33, 0xff2e, 0xff29, 0xff24,
-        0xff1f, 0xff19, 0xff14, 0xff0f, 0xff0a, 0xff05, 0xfeff, 0xfefa, 0xfef5, 0xfeef, 0xfeea,
-        0xfee5, 0xfedf, 0xfeda, 0xfed5, 0xfecf, 0xfeca, 0xfec5, 0xfec0, 0xfeba, 0xfeb5, 0xfeb0,
-        0xfeab, 0xfea5, 0xfea0, 0xfe9b, 0xfe96, 0xfe91, 0xfe8c, 0xfe87, 0xfe82, 0xfe7d, 0xfe79,
-        0xfe74, 0xfe6f, 0xfe6a, 0xfe66, 0xfe61, 0xfe5d, 0xfe59, 0xfe54, 0xfe50, 0xfe4c, 0xfe48,
-        0xfe44, 0xfe40, 0xfe3c, 0xfe39, 0xfe35, 0xfe32, 0xfe2e, 0xfe2b, 0xfe28, 0xfe25, 0xfe22,
-        0xfe1f, 0xfe1d, 0xfe1a, 0xfe17, 0xfe15, 0xfe13, 0xfe11, 0xfe0f, 0xfe0d, 0xfe0b, 0xfe0a,
-        0xfe08, 0xfe07, 0xfe06, 0xfe05, 0xfe04, 0xfe03, 0xfe03, 0xfe02, 0xfe02, 0xfe02, 0xfe01,
-        0xfe02, 0xfe02, 0xfe02, 0xfe03, 0xfe03, 0xfe04, 0xfe05, 0xfe06, 0xfe07, 0xfe08, 0xfe0a,
-        0xfe0b, 0xfe0d, 0xfe0f, 0xfe11, 0xfe13, 0xfe15, 0xfe17, 0xfe1a, 0xfe1d, 0xfe1f, 0xfe22,
-        0xfe25, 0xfe28, 0xfe2b, 0xfe2e, 0xfe32, 0xfe35, 0xfe39, 0xfe3c, 0xfe40, 0xfe44, 0xfe48,
-        0xfe4c, 0xfe50, 0xfe54, 0xfe59, 0xfe5d, 0xfe61, 0xfe66, 0xfe6a, 0xfe6f, 0xfe74, 0xfe79,
-        0xfe7d, 0xfe82, 0xfe87, 0xfe8c, 0xfe91, 0xfe96, 0xfe9b, 0xfea0, 0xfea5, 0xfeab, 0xfeb0,
-        0xfeb5, 0xfeba, 0xfec0, 0xfec5, 0xfeca, 0xfecf, 0xfed5, 0xfeda, 0xfedf, 0xfee5, 0xfeea,
-        0xfeef, 0xfef5, 0xfefa, 0xfeff, 0xff05, 0xff0a, 0xff0f, 0xff14, 0xff19, 0xff1f, 0xff24,
-        0xff29, 0xff2e, 0xff33, 0xff38, 0xff3d, 0xff42, 0xff47, 0xff4c, 0xff51, 0xff56, 0xff5b,
-        0xff5f, 0xff64, 0xff69, 0xff6d, 0xff72, 0xff77, 0xff7b, 0xff80, 0xff84, 0xff89, 0xff8d,
-        0xff91, 0xff96, 0xff9a, 0xff9e, 0xffa3, 0xffa7, 0xffab, 0xffaf, 0xffb3, 0xffb7, 0xffbb,
-        0xffbf, 0xffc3, 0xffc7, 0xffcb, 0xffcf, 0xffd3, 0xffd7, 0xffdb, 0xffde, 0xffe2, 0xffe6,
-        0xffea, 0xffee, 0xfff1, 0xfff5, 0xfff9, 0xfffd,
+        0x01fb, 0x01fc, 0x01fd, 0x01fd, 0x01fe, 0x01fe, 0x01fe, 0x01ff,
     },
 };
 #define oscillator_bltriangle_rows 10
-#define oscillator_bltriangle_cols 512
+#define oscillator_bltriangle_cols 129
 
-static const int16_t oscillator_blsawtooth[10][512] PROGMEM = {
+static const int16_t oscillator_blsawtooth[10][256] oscillator_wavetable_attr = {
     {
         0x0097, 0x018d, 0x01fe, 0x01f2, 0x01af, 0x0183, 0x018c, 0x01b1, 0x01c7, 0x01ba, 0x019d,
         0x018c, 0x0195, 0x01a9, 0x01b1, 0x01a5, 0x0192, 0x018a, 0x0192, 0x019f, 0x01a1, 0x0196,
@@ -1070,30 +338,7 @@ static const int16_t oscillator_blsawtooth[10][512] PROGMEM = {
         0x003b, 0x003b, 0x003b, 0x0038, 0x0035, 0x0032, 0x0031, 0x0031, 0x0030, 0x002e, 0x002a,
         0x0028, 0x0027, 0x0027, 0x0026, 0x0023, 0x0020, 0x001e, 0x001d, 0x001d, 0x001c, 0x0018,
         0x0015, 0x0014, 0x0013, 0x0013, 0x0011, 0x000e, 0x000b, 0x000a, 0x0009, 0x0009, 0x0007,
-        0x0003, 0x0000, 0x0000, 0x0000, 0x0000, 0xfffd, 0xfff9, 0xfff7, 0xfff7, 0xfff6, 0xfff5,
-        0xfff2, 0xffef, 0xffed, 0xffed, 0xffec, 0xffeb, 0xffe8, 0xffe4, 0xffe3, 0xffe3, 0xffe2,
-        0xffe0, 0xffdd, 0xffda, 0xffd9, 0xffd9, 0xffd8, 0xffd6, 0xffd2, 0xffd0, 0xffcf, 0xffcf,
-        0xffce, 0xffcb, 0xffc8, 0xffc5, 0xffc5, 0xffc5, 0xffc3, 0xffc0, 0xffbd, 0xffbb, 0xffbb,
-        0xffbb, 0xffb9, 0xffb6, 0xffb2, 0xffb1, 0xffb1, 0xffb1, 0xffae, 0xffab, 0xffa8, 0xffa7,
-        0xffa7, 0xffa6, 0xffa4, 0xffa0, 0xff9e, 0xff9d, 0xff9d, 0xff9c, 0xff99, 0xff96, 0xff93,
-        0xff93, 0xff93, 0xff92, 0xff8e, 0xff8b, 0xff89, 0xff89, 0xff89, 0xff87, 0xff84, 0xff80,
-        0xff7f, 0xff7f, 0xff7f, 0xff7c, 0xff79, 0xff76, 0xff75, 0xff75, 0xff75, 0xff72, 0xff6e,
-        0xff6c, 0xff6b, 0xff6c, 0xff6a, 0xff67, 0xff63, 0xff61, 0xff61, 0xff62, 0xff60, 0xff5c,
-        0xff59, 0xff57, 0xff58, 0xff57, 0xff55, 0xff52, 0xff4e, 0xff4d, 0xff4e, 0xff4d, 0xff4b,
-        0xff47, 0xff44, 0xff43, 0xff44, 0xff43, 0xff40, 0xff3c, 0xff3a, 0xff3a, 0xff3a, 0xff39,
-        0xff35, 0xff31, 0xff2f, 0xff30, 0xff30, 0xff2e, 0xff2a, 0xff27, 0xff25, 0xff26, 0xff26,
-        0xff24, 0xff1f, 0xff1c, 0xff1b, 0xff1c, 0xff1c, 0xff19, 0xff15, 0xff12, 0xff12, 0xff12,
-        0xff12, 0xff0e, 0xff0a, 0xff07, 0xff08, 0xff09, 0xff07, 0xff03, 0xfeff, 0xfefd, 0xfefe,
-        0xfeff, 0xfefd, 0xfef8, 0xfef4, 0xfef3, 0xfef5, 0xfef5, 0xfef2, 0xfeed, 0xfeea, 0xfee9,
-        0xfeeb, 0xfeeb, 0xfee7, 0xfee2, 0xfedf, 0xfee0, 0xfee1, 0xfee0, 0xfedc, 0xfed7, 0xfed5,
-        0xfed6, 0xfed8, 0xfed6, 0xfed1, 0xfecc, 0xfecb, 0xfecd, 0xfece, 0xfecb, 0xfec6, 0xfec1,
-        0xfec1, 0xfec3, 0xfec4, 0xfec0, 0xfebb, 0xfeb7, 0xfeb7, 0xfeba, 0xfeba, 0xfeb5, 0xfeaf,
-        0xfeac, 0xfeae, 0xfeb1, 0xfeb0, 0xfeaa, 0xfea4, 0xfea2, 0xfea5, 0xfea8, 0xfea5, 0xfe9f,
-        0xfe98, 0xfe98, 0xfe9c, 0xfe9e, 0xfe9b, 0xfe93, 0xfe8d, 0xfe8e, 0xfe93, 0xfe95, 0xfe90,
-        0xfe87, 0xfe82, 0xfe85, 0xfe8b, 0xfe8c, 0xfe84, 0xfe7a, 0xfe77, 0xfe7c, 0xfe83, 0xfe82,
-        0xfe78, 0xfe6d, 0xfe6c, 0xfe74, 0xfe7c, 0xfe78, 0xfe6a, 0xfe5f, 0xfe61, 0xfe6e, 0xfe76,
-        0xfe6e, 0xfe5b, 0xfe4f, 0xfe57, 0xfe6b, 0xfe74, 0xfe63, 0xfe46, 0xfe39, 0xfe4f, 0xfe74,
-        0xfe7d, 0xfe51, 0xfe0e, 0xfe01, 0xfe73, 0xff69,
+        0x0003, 0x0000, 0x0000,
     },
     {
         0x0049, 0x00d7, 0x0151, 0x01ad, 0x01e7, 0x01ff, 0x01fa, 0x01e2, 0x01c0, 0x019f, 0x0187,
@@ -1119,30 +364,7 @@ static const int16_t oscillator_blsawtooth[10][512] PROGMEM = {
         0x003d, 0x003a, 0x0037, 0x0034, 0x0033, 0x0032, 0x0032, 0x0032, 0x0032, 0x0031, 0x002e,
         0x002b, 0x0028, 0x0025, 0x0022, 0x0020, 0x001e, 0x001e, 0x001e, 0x001e, 0x001d, 0x001c,
         0x0019, 0x0016, 0x0013, 0x0010, 0x000d, 0x000b, 0x000a, 0x000a, 0x000a, 0x0009, 0x0009,
-        0x0007, 0x0004, 0x0001, 0xffff, 0xfffc, 0xfff9, 0xfff7, 0xfff7, 0xfff6, 0xfff6, 0xfff6,
-        0xfff5, 0xfff3, 0xfff0, 0xffed, 0xffea, 0xffe7, 0xffe4, 0xffe3, 0xffe2, 0xffe2, 0xffe2,
-        0xffe2, 0xffe0, 0xffde, 0xffdb, 0xffd8, 0xffd5, 0xffd2, 0xffcf, 0xffce, 0xffce, 0xffce,
-        0xffce, 0xffcd, 0xffcc, 0xffc9, 0xffc6, 0xffc3, 0xffbf, 0xffbd, 0xffbb, 0xffba, 0xffb9,
-        0xffb9, 0xffb9, 0xffb9, 0xffb7, 0xffb4, 0xffb1, 0xffae, 0xffaa, 0xffa8, 0xffa6, 0xffa5,
-        0xffa5, 0xffa5, 0xffa5, 0xffa4, 0xffa2, 0xff9f, 0xff9c, 0xff99, 0xff95, 0xff93, 0xff91,
-        0xff91, 0xff91, 0xff91, 0xff91, 0xff90, 0xff8d, 0xff8a, 0xff87, 0xff83, 0xff80, 0xff7e,
-        0xff7d, 0xff7c, 0xff7c, 0xff7d, 0xff7c, 0xff7b, 0xff79, 0xff75, 0xff72, 0xff6e, 0xff6b,
-        0xff69, 0xff68, 0xff68, 0xff68, 0xff68, 0xff68, 0xff66, 0xff64, 0xff60, 0xff5d, 0xff59,
-        0xff56, 0xff54, 0xff54, 0xff54, 0xff54, 0xff54, 0xff53, 0xff52, 0xff4f, 0xff4b, 0xff47,
-        0xff44, 0xff41, 0xff3f, 0xff3f, 0xff3f, 0xff40, 0xff40, 0xff3f, 0xff3d, 0xff3a, 0xff36,
-        0xff32, 0xff2f, 0xff2c, 0xff2b, 0xff2b, 0xff2b, 0xff2c, 0xff2c, 0xff2b, 0xff28, 0xff25,
-        0xff21, 0xff1d, 0xff19, 0xff17, 0xff16, 0xff16, 0xff17, 0xff18, 0xff18, 0xff16, 0xff14,
-        0xff10, 0xff0b, 0xff07, 0xff04, 0xff02, 0xff01, 0xff02, 0xff03, 0xff04, 0xff03, 0xff02,
-        0xfeff, 0xfefb, 0xfef6, 0xfef2, 0xfeee, 0xfeed, 0xfeed, 0xfeee, 0xfeef, 0xfef0, 0xfef0,
-        0xfeee, 0xfeea, 0xfee5, 0xfee0, 0xfedc, 0xfed9, 0xfed8, 0xfed8, 0xfeda, 0xfedb, 0xfedc,
-        0xfedc, 0xfed9, 0xfed5, 0xfed0, 0xfeca, 0xfec6, 0xfec3, 0xfec3, 0xfec4, 0xfec6, 0xfec8,
-        0xfec9, 0xfec8, 0xfec5, 0xfec0, 0xfeba, 0xfeb4, 0xfeb0, 0xfead, 0xfead, 0xfeaf, 0xfeb2,
-        0xfeb5, 0xfeb6, 0xfeb5, 0xfeb1, 0xfeab, 0xfea4, 0xfe9e, 0xfe99, 0xfe97, 0xfe98, 0xfe9b,
-        0xfe9f, 0xfea3, 0xfea4, 0xfea2, 0xfe9d, 0xfe95, 0xfe8d, 0xfe86, 0xfe81, 0xfe80, 0xfe83,
-        0xfe88, 0xfe8d, 0xfe92, 0xfe93, 0xfe90, 0xfe89, 0xfe7f, 0xfe74, 0xfe6c, 0xfe67, 0xfe68,
-        0xfe6d, 0xfe75, 0xfe7e, 0xfe84, 0xfe85, 0xfe80, 0xfe75, 0xfe66, 0xfe57, 0xfe4c, 0xfe47,
-        0xfe4b, 0xfe57, 0xfe68, 0xfe79, 0xfe84, 0xfe85, 0xfe79, 0xfe61, 0xfe40, 0xfe1e, 0xfe06,
-        0xfe01, 0xfe19, 0xfe53, 0xfeaf, 0xff29, 0xffb7,
+        0x0007, 0x0004, 0x0001,
     },
     {
         0x0024, 0x006d, 0x00b4, 0x00f6, 0x0133, 0x0169, 0x0197, 0x01bd, 0x01da, 0x01ee, 0x01fa,
@@ -1168,30 +390,7 @@ static const int16_t oscillator_blsawtooth[10][512] PROGMEM = {
         0x003e, 0x003e, 0x003e, 0x003e, 0x003d, 0x003c, 0x003a, 0x0038, 0x0036, 0x0033, 0x002f,
         0x002c, 0x0028, 0x0025, 0x0021, 0x001e, 0x001c, 0x0019, 0x0018, 0x0016, 0x0015, 0x0015,
         0x0015, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0013, 0x0012, 0x0010, 0x000e, 0x000b,
-        0x0008, 0x0005, 0x0001, 0xffff, 0xfffb, 0xfff8, 0xfff5, 0xfff2, 0xfff0, 0xffee, 0xffed,
-        0xffec, 0xffec, 0xffec, 0xffec, 0xffec, 0xffeb, 0xffeb, 0xffeb, 0xffea, 0xffe8, 0xffe7,
-        0xffe4, 0xffe2, 0xffdf, 0xffdb, 0xffd8, 0xffd4, 0xffd1, 0xffcd, 0xffca, 0xffc8, 0xffc6,
-        0xffc4, 0xffc3, 0xffc2, 0xffc2, 0xffc2, 0xffc2, 0xffc2, 0xffc2, 0xffc1, 0xffc1, 0xffc0,
-        0xffbe, 0xffbc, 0xffba, 0xffb7, 0xffb4, 0xffb1, 0xffad, 0xffa9, 0xffa6, 0xffa3, 0xffa0,
-        0xff9d, 0xff9b, 0xff9a, 0xff99, 0xff98, 0xff98, 0xff98, 0xff98, 0xff98, 0xff98, 0xff98,
-        0xff97, 0xff96, 0xff94, 0xff92, 0xff90, 0xff8d, 0xff8a, 0xff86, 0xff82, 0xff7f, 0xff7b,
-        0xff78, 0xff75, 0xff73, 0xff71, 0xff6f, 0xff6e, 0xff6e, 0xff6e, 0xff6e, 0xff6e, 0xff6e,
-        0xff6e, 0xff6e, 0xff6d, 0xff6c, 0xff6b, 0xff69, 0xff66, 0xff63, 0xff5f, 0xff5c, 0xff58,
-        0xff54, 0xff50, 0xff4d, 0xff4a, 0xff47, 0xff46, 0xff44, 0xff44, 0xff43, 0xff43, 0xff44,
-        0xff44, 0xff45, 0xff45, 0xff45, 0xff44, 0xff43, 0xff41, 0xff3f, 0xff3c, 0xff39, 0xff35,
-        0xff31, 0xff2d, 0xff29, 0xff25, 0xff22, 0xff1f, 0xff1c, 0xff1a, 0xff19, 0xff19, 0xff19,
-        0xff19, 0xff1a, 0xff1b, 0xff1b, 0xff1c, 0xff1c, 0xff1b, 0xff1a, 0xff18, 0xff16, 0xff13,
-        0xff0f, 0xff0b, 0xff06, 0xff02, 0xfefd, 0xfef9, 0xfef6, 0xfef3, 0xfef0, 0xfeef, 0xfeee,
-        0xfeed, 0xfeee, 0xfeef, 0xfef0, 0xfef1, 0xfef2, 0xfef3, 0xfef4, 0xfef3, 0xfef2, 0xfef0,
-        0xfeed, 0xfeea, 0xfee5, 0xfee1, 0xfedc, 0xfed6, 0xfed1, 0xfecd, 0xfec9, 0xfec6, 0xfec3,
-        0xfec2, 0xfec1, 0xfec2, 0xfec3, 0xfec4, 0xfec7, 0xfec9, 0xfecb, 0xfecc, 0xfecd, 0xfecd,
-        0xfecb, 0xfec9, 0xfec6, 0xfec1, 0xfebc, 0xfeb6, 0xfeb0, 0xfeaa, 0xfea4, 0xfe9f, 0xfe9a,
-        0xfe96, 0xfe94, 0xfe93, 0xfe93, 0xfe95, 0xfe97, 0xfe9a, 0xfe9e, 0xfea2, 0xfea5, 0xfea8,
-        0xfea9, 0xfeaa, 0xfea8, 0xfea6, 0xfea1, 0xfe9b, 0xfe94, 0xfe8c, 0xfe83, 0xfe7b, 0xfe72,
-        0xfe6b, 0xfe65, 0xfe61, 0xfe5e, 0xfe5e, 0xfe60, 0xfe64, 0xfe6a, 0xfe71, 0xfe79, 0xfe81,
-        0xfe88, 0xfe8e, 0xfe93, 0xfe94, 0xfe93, 0xfe8f, 0xfe87, 0xfe7c, 0xfe6e, 0xfe5e, 0xfe4c,
-        0xfe3a, 0xfe28, 0xfe18, 0xfe0c, 0xfe04, 0xfe01, 0xfe06, 0xfe12, 0xfe26, 0xfe43, 0xfe69,
-        0xfe97, 0xfecd, 0xff0a, 0xff4c, 0xff93, 0xffdc,
+        0x0008, 0x0005, 0x0001,
     },
     {
         0x01fe, 0x01d4, 0x01fa, 0x01d1, 0x01f6, 0x01ce, 0x01f1, 0x01cc, 0x01eb, 0x01c9, 0x01e6,
@@ -1217,30 +416,7 @@ static const int16_t oscillator_blsawtooth[10][512] PROGMEM = {
         0x0044, 0x0042, 0x003f, 0x003e, 0x003b, 0x003b, 0x0037, 0x0037, 0x0033, 0x0033, 0x0030,
         0x0030, 0x002c, 0x002c, 0x0028, 0x0028, 0x0024, 0x0024, 0x0021, 0x0020, 0x001d, 0x001c,
         0x0019, 0x0018, 0x0016, 0x0013, 0x0012, 0x000f, 0x000e, 0x000b, 0x000b, 0x0007, 0x0007,
-        0x0003, 0x0003, 0x0000, 0x0000, 0xfffd, 0xfffd, 0xfff9, 0xfff9, 0xfff5, 0xfff5, 0xfff2,
-        0xfff1, 0xffee, 0xffed, 0xffea, 0xffe8, 0xffe7, 0xffe4, 0xffe3, 0xffe0, 0xffdf, 0xffdc,
-        0xffdc, 0xffd8, 0xffd8, 0xffd4, 0xffd4, 0xffd0, 0xffd0, 0xffcd, 0xffcd, 0xffc9, 0xffc9,
-        0xffc5, 0xffc5, 0xffc2, 0xffc1, 0xffbe, 0xffbc, 0xffba, 0xffb8, 0xffb7, 0xffb4, 0xffb3,
-        0xffb0, 0xffb0, 0xffac, 0xffac, 0xffa8, 0xffa8, 0xffa4, 0xffa4, 0xffa0, 0xffa0, 0xff9d,
-        0xff9d, 0xff99, 0xff99, 0xff95, 0xff95, 0xff92, 0xff90, 0xff8e, 0xff8c, 0xff8a, 0xff88,
-        0xff87, 0xff84, 0xff83, 0xff80, 0xff80, 0xff7c, 0xff7c, 0xff78, 0xff78, 0xff74, 0xff74,
-        0xff70, 0xff71, 0xff6d, 0xff6d, 0xff69, 0xff69, 0xff65, 0xff64, 0xff62, 0xff60, 0xff5e,
-        0xff5c, 0xff5b, 0xff58, 0xff57, 0xff54, 0xff53, 0xff50, 0xff50, 0xff4c, 0xff4c, 0xff48,
-        0xff48, 0xff44, 0xff44, 0xff40, 0xff41, 0xff3c, 0xff3d, 0xff39, 0xff39, 0xff35, 0xff34,
-        0xff32, 0xff30, 0xff2e, 0xff2c, 0xff2b, 0xff28, 0xff27, 0xff24, 0xff23, 0xff20, 0xff20,
-        0xff1c, 0xff1c, 0xff18, 0xff18, 0xff14, 0xff15, 0xff10, 0xff11, 0xff0c, 0xff0d, 0xff09,
-        0xff09, 0xff05, 0xff04, 0xff02, 0xff00, 0xfefe, 0xfefc, 0xfefb, 0xfef8, 0xfef7, 0xfef4,
-        0xfef4, 0xfeef, 0xfef0, 0xfeeb, 0xfeec, 0xfee7, 0xfee9, 0xfee4, 0xfee5, 0xfee0, 0xfee1,
-        0xfedc, 0xfedd, 0xfed9, 0xfed9, 0xfed5, 0xfed4, 0xfed2, 0xfed0, 0xfece, 0xfecc, 0xfecb,
-        0xfec7, 0xfec8, 0xfec3, 0xfec4, 0xfebf, 0xfec0, 0xfebb, 0xfebd, 0xfeb7, 0xfeb9, 0xfeb3,
-        0xfeb5, 0xfeb0, 0xfeb1, 0xfeac, 0xfead, 0xfea8, 0xfea9, 0xfea5, 0xfea4, 0xfea2, 0xfea0,
-        0xfe9f, 0xfe9b, 0xfe9b, 0xfe97, 0xfe98, 0xfe93, 0xfe95, 0xfe8e, 0xfe91, 0xfe8a, 0xfe8d,
-        0xfe86, 0xfe8a, 0xfe83, 0xfe86, 0xfe7f, 0xfe82, 0xfe7b, 0xfe7d, 0xfe78, 0xfe79, 0xfe75,
-        0xfe74, 0xfe72, 0xfe6f, 0xfe6f, 0xfe6b, 0xfe6c, 0xfe66, 0xfe69, 0xfe61, 0xfe66, 0xfe5d,
-        0xfe63, 0xfe59, 0xfe5f, 0xfe55, 0xfe5b, 0xfe51, 0xfe57, 0xfe4d, 0xfe53, 0xfe4a, 0xfe4e,
-        0xfe47, 0xfe49, 0xfe45, 0xfe44, 0xfe43, 0xfe3e, 0xfe41, 0xfe38, 0xfe3f, 0xfe32, 0xfe3d,
-        0xfe2c, 0xfe3c, 0xfe26, 0xfe3a, 0xfe20, 0xfe38, 0xfe1a, 0xfe37, 0xfe15, 0xfe34, 0xfe0f,
-        0xfe32, 0xfe0a, 0xfe2f, 0xfe06, 0xfe2c, 0xfe01,
+        0x0003, 0x0003, 0x0000,
     },
     {
         0x00e6, 0x01fe, 0x01ea, 0x018c, 0x019d, 0x01d0, 0x01bc, 0x0196, 0x01a7, 0x01bf, 0x01ac,
@@ -1266,30 +442,7 @@ static const int16_t oscillator_blsawtooth[10][512] PROGMEM = {
         0x003e, 0x003b, 0x0038, 0x0038, 0x0037, 0x0034, 0x0032, 0x0031, 0x0030, 0x002d, 0x002b,
         0x002b, 0x0029, 0x0026, 0x0024, 0x0024, 0x0022, 0x001f, 0x001d, 0x001d, 0x001b, 0x0017,
         0x0017, 0x0016, 0x0013, 0x0011, 0x0010, 0x000f, 0x000c, 0x000a, 0x000a, 0x0008, 0x0005,
-        0x0003, 0x0003, 0x0001, 0xffff, 0xfffd, 0xfffd, 0xfffb, 0xfff8, 0xfff6, 0xfff6, 0xfff4,
-        0xfff1, 0xfff0, 0xffef, 0xffed, 0xffea, 0xffe9, 0xffe9, 0xffe5, 0xffe3, 0xffe3, 0xffe1,
-        0xffde, 0xffdc, 0xffdc, 0xffda, 0xffd7, 0xffd5, 0xffd5, 0xffd3, 0xffd0, 0xffcf, 0xffce,
-        0xffcc, 0xffc9, 0xffc8, 0xffc8, 0xffc5, 0xffc2, 0xffc1, 0xffc1, 0xffbd, 0xffbb, 0xffbb,
-        0xffba, 0xffb6, 0xffb4, 0xffb4, 0xffb3, 0xffaf, 0xffad, 0xffad, 0xffab, 0xffa8, 0xffa7,
-        0xffa7, 0xffa4, 0xffa1, 0xffa0, 0xffa0, 0xff9d, 0xff9a, 0xff99, 0xff99, 0xff96, 0xff93,
-        0xff93, 0xff92, 0xff8e, 0xff8c, 0xff8c, 0xff8b, 0xff87, 0xff85, 0xff86, 0xff83, 0xff80,
-        0xff7f, 0xff7f, 0xff7c, 0xff79, 0xff78, 0xff78, 0xff75, 0xff72, 0xff72, 0xff71, 0xff6e,
-        0xff6b, 0xff6b, 0xff6a, 0xff66, 0xff64, 0xff64, 0xff63, 0xff5f, 0xff5d, 0xff5e, 0xff5c,
-        0xff58, 0xff57, 0xff57, 0xff54, 0xff51, 0xff50, 0xff50, 0xff4d, 0xff4a, 0xff4a, 0xff49,
-        0xff46, 0xff43, 0xff43, 0xff42, 0xff3e, 0xff3c, 0xff3d, 0xff3b, 0xff37, 0xff35, 0xff36,
-        0xff34, 0xff30, 0xff2f, 0xff2f, 0xff2d, 0xff29, 0xff28, 0xff28, 0xff25, 0xff22, 0xff22,
-        0xff22, 0xff1e, 0xff1b, 0xff1b, 0xff1b, 0xff16, 0xff14, 0xff15, 0xff13, 0xff0f, 0xff0d,
-        0xff0e, 0xff0c, 0xff08, 0xff07, 0xff08, 0xff05, 0xff01, 0xff00, 0xff01, 0xfefd, 0xfef9,
-        0xfefa, 0xfefa, 0xfef6, 0xfef3, 0xfef3, 0xfef3, 0xfeee, 0xfeec, 0xfeed, 0xfeec, 0xfee7,
-        0xfee5, 0xfee7, 0xfee5, 0xfee0, 0xfedf, 0xfee0, 0xfedd, 0xfed8, 0xfed8, 0xfed9, 0xfed6,
-        0xfed1, 0xfed2, 0xfed3, 0xfece, 0xfeca, 0xfecc, 0xfecc, 0xfec6, 0xfec3, 0xfec5, 0xfec4,
-        0xfebf, 0xfebd, 0xfebf, 0xfebd, 0xfeb7, 0xfeb6, 0xfeb9, 0xfeb6, 0xfeb0, 0xfeb0, 0xfeb2,
-        0xfeae, 0xfea8, 0xfeaa, 0xfeac, 0xfea6, 0xfea1, 0xfea4, 0xfea5, 0xfe9e, 0xfe9a, 0xfe9e,
-        0xfe9e, 0xfe96, 0xfe94, 0xfe98, 0xfe96, 0xfe8e, 0xfe8d, 0xfe92, 0xfe8e, 0xfe86, 0xfe88,
-        0xfe8c, 0xfe86, 0xfe7e, 0xfe82, 0xfe86, 0xfe7e, 0xfe77, 0xfe7d, 0xfe7f, 0xfe75, 0xfe70,
-        0xfe78, 0xfe79, 0xfe6c, 0xfe69, 0xfe73, 0xfe71, 0xfe63, 0xfe63, 0xfe6f, 0xfe69, 0xfe59,
-        0xfe5e, 0xfe6c, 0xfe60, 0xfe4e, 0xfe5a, 0xfe69, 0xfe54, 0xfe41, 0xfe59, 0xfe6a, 0xfe44,
-        0xfe30, 0xfe63, 0xfe74, 0xfe16, 0xfe01, 0xff1a,
+        0x0003, 0x0003, 0x0001,
     },
     {
         0x006f, 0x013a, 0x01c4, 0x01fe, 0x01f4, 0x01c5, 0x0195, 0x017e, 0x0185, 0x019e, 0x01b7,
@@ -1315,30 +468,7 @@ static const int16_t oscillator_blsawtooth[10][512] PROGMEM = {
         0x003e, 0x003a, 0x0037, 0x0035, 0x0034, 0x0034, 0x0034, 0x0032, 0x0030, 0x002c, 0x0029,
         0x0028, 0x0027, 0x0027, 0x0026, 0x0025, 0x0021, 0x001e, 0x001b, 0x001a, 0x001a, 0x001a,
         0x0019, 0x0016, 0x0013, 0x0010, 0x000e, 0x000d, 0x000d, 0x000c, 0x000b, 0x0008, 0x0005,
-        0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0xfffe, 0xfffb, 0xfff8, 0xfff5, 0xfff4, 0xfff3,
-        0xfff3, 0xfff2, 0xfff0, 0xffed, 0xffea, 0xffe7, 0xffe6, 0xffe6, 0xffe6, 0xffe5, 0xffe2,
-        0xffdf, 0xffdb, 0xffda, 0xffd9, 0xffd9, 0xffd8, 0xffd7, 0xffd4, 0xffd0, 0xffce, 0xffcc,
-        0xffcc, 0xffcc, 0xffcb, 0xffc9, 0xffc6, 0xffc2, 0xffc0, 0xffbf, 0xffbe, 0xffbe, 0xffbd,
-        0xffbb, 0xffb7, 0xffb4, 0xffb2, 0xffb1, 0xffb1, 0xffb1, 0xffaf, 0xffad, 0xffa9, 0xffa6,
-        0xffa4, 0xffa4, 0xffa4, 0xffa4, 0xffa2, 0xff9e, 0xff9b, 0xff98, 0xff97, 0xff97, 0xff97,
-        0xff96, 0xff94, 0xff90, 0xff8d, 0xff8a, 0xff8a, 0xff8a, 0xff8a, 0xff88, 0xff85, 0xff82,
-        0xff7f, 0xff7d, 0xff7c, 0xff7d, 0xff7c, 0xff7a, 0xff77, 0xff73, 0xff71, 0xff6f, 0xff6f,
-        0xff6f, 0xff6f, 0xff6c, 0xff69, 0xff65, 0xff63, 0xff62, 0xff62, 0xff62, 0xff61, 0xff5e,
-        0xff5a, 0xff57, 0xff55, 0xff55, 0xff55, 0xff55, 0xff53, 0xff50, 0xff4c, 0xff49, 0xff47,
-        0xff48, 0xff48, 0xff47, 0xff45, 0xff42, 0xff3e, 0xff3b, 0xff3a, 0xff3a, 0xff3b, 0xff3a,
-        0xff37, 0xff33, 0xff2f, 0xff2d, 0xff2d, 0xff2d, 0xff2e, 0xff2c, 0xff29, 0xff25, 0xff21,
-        0xff20, 0xff20, 0xff21, 0xff20, 0xff1e, 0xff1a, 0xff16, 0xff13, 0xff12, 0xff13, 0xff14,
-        0xff13, 0xff10, 0xff0c, 0xff08, 0xff05, 0xff05, 0xff06, 0xff06, 0xff05, 0xff02, 0xfefd,
-        0xfef9, 0xfef8, 0xfef8, 0xfef9, 0xfef9, 0xfef7, 0xfef3, 0xfeef, 0xfeeb, 0xfeea, 0xfeeb,
-        0xfeec, 0xfeec, 0xfee9, 0xfee5, 0xfee0, 0xfedd, 0xfedd, 0xfede, 0xfee0, 0xfedf, 0xfedb,
-        0xfed6, 0xfed1, 0xfecf, 0xfed0, 0xfed2, 0xfed3, 0xfed1, 0xfecd, 0xfec7, 0xfec3, 0xfec1,
-        0xfec3, 0xfec5, 0xfec6, 0xfec3, 0xfebe, 0xfeb8, 0xfeb4, 0xfeb4, 0xfeb7, 0xfeb9, 0xfeb9,
-        0xfeb5, 0xfeaf, 0xfea9, 0xfea6, 0xfea7, 0xfeaa, 0xfead, 0xfeac, 0xfea6, 0xfe9f, 0xfe99,
-        0xfe98, 0xfe9b, 0xfe9f, 0xfea1, 0xfe9e, 0xfe97, 0xfe8f, 0xfe8a, 0xfe8a, 0xfe8f, 0xfe94,
-        0xfe95, 0xfe90, 0xfe87, 0xfe7e, 0xfe7a, 0xfe7d, 0xfe84, 0xfe89, 0xfe89, 0xfe82, 0xfe76,
-        0xfe6d, 0xfe6b, 0xfe71, 0xfe7a, 0xfe80, 0xfe7e, 0xfe72, 0xfe63, 0xfe59, 0xfe5a, 0xfe66,
-        0xfe74, 0xfe7b, 0xfe73, 0xfe5f, 0xfe49, 0xfe3f, 0xfe49, 0xfe62, 0xfe7b, 0xfe82, 0xfe6b,
-        0xfe3b, 0xfe0c, 0xfe01, 0xfe3c, 0xfec6, 0xff91,
+        0x0002, 0x0000, 0x0000,
     },
     {
         0x002c, 0x009b, 0x0101, 0x0159, 0x01a0, 0x01d3, 0x01f2, 0x01fe, 0x01fb, 0x01eb, 0x01d4,
@@ -1364,30 +494,7 @@ static const int16_t oscillator_blsawtooth[10][512] PROGMEM = {
         0x0038, 0x0037, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0035, 0x0034, 0x0031, 0x002f,
         0x002b, 0x0028, 0x0024, 0x0021, 0x001f, 0x001d, 0x001b, 0x001b, 0x001b, 0x001b, 0x001b,
         0x001a, 0x0019, 0x0018, 0x0016, 0x0013, 0x000f, 0x000c, 0x0008, 0x0005, 0x0003, 0x0001,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xfffd, 0xfffb, 0xfff8, 0xfff4,
-        0xfff1, 0xffed, 0xffea, 0xffe8, 0xffe7, 0xffe6, 0xffe5, 0xffe5, 0xffe5, 0xffe5, 0xffe5,
-        0xffe3, 0xffe1, 0xffdf, 0xffdc, 0xffd8, 0xffd5, 0xffd1, 0xffcf, 0xffcc, 0xffcb, 0xffca,
-        0xffca, 0xffca, 0xffca, 0xffca, 0xffc9, 0xffc8, 0xffc6, 0xffc3, 0xffbf, 0xffbc, 0xffb8,
-        0xffb5, 0xffb3, 0xffb1, 0xffaf, 0xffaf, 0xffaf, 0xffaf, 0xffaf, 0xffaf, 0xffae, 0xffac,
-        0xffaa, 0xffa7, 0xffa3, 0xffa0, 0xff9c, 0xff99, 0xff97, 0xff95, 0xff94, 0xff93, 0xff93,
-        0xff94, 0xff94, 0xff93, 0xff92, 0xff90, 0xff8e, 0xff8b, 0xff87, 0xff84, 0xff80, 0xff7d,
-        0xff7b, 0xff79, 0xff78, 0xff78, 0xff78, 0xff78, 0xff78, 0xff78, 0xff77, 0xff75, 0xff72,
-        0xff6f, 0xff6b, 0xff67, 0xff64, 0xff61, 0xff5f, 0xff5d, 0xff5d, 0xff5d, 0xff5d, 0xff5d,
-        0xff5d, 0xff5d, 0xff5c, 0xff59, 0xff56, 0xff53, 0xff4f, 0xff4b, 0xff48, 0xff45, 0xff43,
-        0xff41, 0xff41, 0xff41, 0xff42, 0xff42, 0xff42, 0xff42, 0xff40, 0xff3e, 0xff3b, 0xff37,
-        0xff33, 0xff2f, 0xff2b, 0xff28, 0xff27, 0xff26, 0xff26, 0xff26, 0xff27, 0xff27, 0xff28,
-        0xff27, 0xff25, 0xff22, 0xff1f, 0xff1a, 0xff16, 0xff12, 0xff0f, 0xff0c, 0xff0a, 0xff0a,
-        0xff0a, 0xff0b, 0xff0c, 0xff0d, 0xff0d, 0xff0c, 0xff0a, 0xff07, 0xff03, 0xfefe, 0xfefa,
-        0xfef5, 0xfef2, 0xfeef, 0xfeee, 0xfeee, 0xfeef, 0xfef0, 0xfef1, 0xfef2, 0xfef2, 0xfef1,
-        0xfeef, 0xfeeb, 0xfee7, 0xfee2, 0xfedd, 0xfed8, 0xfed5, 0xfed2, 0xfed2, 0xfed2, 0xfed3,
-        0xfed5, 0xfed7, 0xfed8, 0xfed8, 0xfed7, 0xfed4, 0xfed0, 0xfecb, 0xfec5, 0xfebf, 0xfeba,
-        0xfeb7, 0xfeb5, 0xfeb5, 0xfeb6, 0xfeb8, 0xfebb, 0xfebe, 0xfebf, 0xfebf, 0xfebd, 0xfeba,
-        0xfeb4, 0xfeae, 0xfea7, 0xfea1, 0xfe9c, 0xfe98, 0xfe97, 0xfe98, 0xfe9a, 0xfe9e, 0xfea2,
-        0xfea5, 0xfea7, 0xfea7, 0xfea5, 0xfea0, 0xfe99, 0xfe91, 0xfe89, 0xfe81, 0xfe7b, 0xfe77,
-        0xfe77, 0xfe79, 0xfe7e, 0xfe84, 0xfe8a, 0xfe90, 0xfe93, 0xfe93, 0xfe90, 0xfe88, 0xfe7e,
-        0xfe72, 0xfe66, 0xfe5b, 0xfe53, 0xfe50, 0xfe51, 0xfe58, 0xfe62, 0xfe6e, 0xfe7b, 0xfe86,
-        0xfe8d, 0xfe8d, 0xfe85, 0xfe76, 0xfe61, 0xfe47, 0xfe2c, 0xfe15, 0xfe05, 0xfe01, 0xfe0e,
-        0xfe2d, 0xfe60, 0xfea7, 0xfeff, 0xff65, 0xffd4,
+        0x0000, 0x0000, 0x0000,
     },
     {
         0x0017, 0x0050, 0x0088, 0x00be, 0x00f2, 0x0122, 0x014e, 0x0176, 0x0198, 0x01b6, 0x01cf,
@@ -1413,30 +520,7 @@ static const int16_t oscillator_blsawtooth[10][512] PROGMEM = {
         0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0036, 0x0036, 0x0035,
         0x0034, 0x0032, 0x0030, 0x002e, 0x002c, 0x0029, 0x0026, 0x0022, 0x001f, 0x001b, 0x0018,
         0x0014, 0x0011, 0x000e, 0x000b, 0x0008, 0x0006, 0x0004, 0x0002, 0x0001, 0x0000, 0x0000,
-        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xfffe, 0xfffc,
-        0xfffa, 0xfff8, 0xfff5, 0xfff2, 0xffef, 0xffec, 0xffe8, 0xffe5, 0xffe1, 0xffde, 0xffda,
-        0xffd7, 0xffd4, 0xffd2, 0xffd0, 0xffce, 0xffcc, 0xffcb, 0xffca, 0xffca, 0xffc9, 0xffc9,
-        0xffc9, 0xffc9, 0xffc9, 0xffc9, 0xffc9, 0xffc9, 0xffc8, 0xffc7, 0xffc5, 0xffc3, 0xffc1,
-        0xffbe, 0xffbc, 0xffb8, 0xffb5, 0xffb1, 0xffae, 0xffaa, 0xffa6, 0xffa3, 0xffa0, 0xff9d,
-        0xff9a, 0xff98, 0xff96, 0xff95, 0xff93, 0xff93, 0xff92, 0xff92, 0xff92, 0xff92, 0xff92,
-        0xff92, 0xff92, 0xff92, 0xff92, 0xff91, 0xff90, 0xff8f, 0xff8d, 0xff8a, 0xff88, 0xff85,
-        0xff82, 0xff7e, 0xff7a, 0xff77, 0xff73, 0xff6f, 0xff6b, 0xff68, 0xff65, 0xff62, 0xff60,
-        0xff5e, 0xff5d, 0xff5b, 0xff5b, 0xff5a, 0xff5a, 0xff5a, 0xff5b, 0xff5b, 0xff5b, 0xff5c,
-        0xff5c, 0xff5b, 0xff5b, 0xff5a, 0xff58, 0xff57, 0xff54, 0xff52, 0xff4e, 0xff4b, 0xff47,
-        0xff43, 0xff3f, 0xff3b, 0xff37, 0xff33, 0xff30, 0xff2d, 0xff2a, 0xff27, 0xff25, 0xff24,
-        0xff23, 0xff22, 0xff22, 0xff22, 0xff23, 0xff23, 0xff24, 0xff25, 0xff25, 0xff26, 0xff26,
-        0xff25, 0xff25, 0xff23, 0xff21, 0xff1f, 0xff1c, 0xff19, 0xff15, 0xff11, 0xff0d, 0xff08,
-        0xff04, 0xfeff, 0xfefb, 0xfef7, 0xfef3, 0xfef0, 0xfeee, 0xfeec, 0xfeea, 0xfee9, 0xfee9,
-        0xfee9, 0xfeea, 0xfeeb, 0xfeec, 0xfeed, 0xfeef, 0xfef0, 0xfef1, 0xfef1, 0xfef1, 0xfef1,
-        0xfef0, 0xfeee, 0xfeeb, 0xfee8, 0xfee4, 0xfee0, 0xfedb, 0xfed6, 0xfed1, 0xfecb, 0xfec6,
-        0xfec1, 0xfebc, 0xfeb8, 0xfeb4, 0xfeb2, 0xfeaf, 0xfeae, 0xfeae, 0xfeae, 0xfeaf, 0xfeb0,
-        0xfeb2, 0xfeb5, 0xfeb7, 0xfeba, 0xfebc, 0xfebe, 0xfec0, 0xfec0, 0xfec0, 0xfec0, 0xfebe,
-        0xfebb, 0xfeb7, 0xfeb2, 0xfead, 0xfea7, 0xfea0, 0xfe99, 0xfe91, 0xfe8a, 0xfe83, 0xfe7d,
-        0xfe77, 0xfe72, 0xfe6f, 0xfe6d, 0xfe6b, 0xfe6c, 0xfe6d, 0xfe70, 0xfe74, 0xfe79, 0xfe7e,
-        0xfe84, 0xfe8a, 0xfe8f, 0xfe95, 0xfe99, 0xfe9c, 0xfe9e, 0xfe9e, 0xfe9c, 0xfe98, 0xfe92,
-        0xfe8a, 0xfe81, 0xfe75, 0xfe68, 0xfe5a, 0xfe4c, 0xfe3d, 0xfe2f, 0xfe21, 0xfe16, 0xfe0c,
-        0xfe05, 0xfe01, 0xfe02, 0xfe06, 0xfe10, 0xfe1e, 0xfe31, 0xfe4a, 0xfe68, 0xfe8a, 0xfeb2,
-        0xfede, 0xff0e, 0xff42, 0xff78, 0xffb0, 0xffe9,
+        0x0000, 0x0000, 0x0000,
     },
     {
         0xffd9, 0xfff7, 0x0013, 0x002f, 0x004c, 0x0068, 0x0084, 0x009f, 0x00b9, 0x00d3, 0x00ec,
@@ -1462,30 +546,7 @@ static const int16_t oscillator_blsawtooth[10][512] PROGMEM = {
         0x003e, 0x003f, 0x003f, 0x003f, 0x003f, 0x0040, 0x0040, 0x0040, 0x0040, 0x003f, 0x003f,
         0x003f, 0x003e, 0x003d, 0x003c, 0x003b, 0x003a, 0x0038, 0x0037, 0x0035, 0x0033, 0x0030,
         0x002e, 0x002b, 0x0029, 0x0026, 0x0022, 0x001f, 0x001c, 0x0018, 0x0015, 0x0011, 0x000d,
-        0x0009, 0x0005, 0x0001, 0xffff, 0xfffb, 0xfff7, 0xfff3, 0xffef, 0xffeb, 0xffe8, 0xffe4,
-        0xffe1, 0xffde, 0xffda, 0xffd7, 0xffd5, 0xffd2, 0xffd0, 0xffcd, 0xffcb, 0xffc9, 0xffc8,
-        0xffc6, 0xffc5, 0xffc4, 0xffc3, 0xffc2, 0xffc1, 0xffc1, 0xffc1, 0xffc0, 0xffc0, 0xffc0,
-        0xffc0, 0xffc1, 0xffc1, 0xffc1, 0xffc1, 0xffc2, 0xffc2, 0xffc2, 0xffc2, 0xffc2, 0xffc2,
-        0xffc2, 0xffc2, 0xffc1, 0xffc1, 0xffc0, 0xffbf, 0xffbe, 0xffbd, 0xffbc, 0xffba, 0xffb8,
-        0xffb6, 0xffb4, 0xffb1, 0xffaf, 0xffac, 0xffa9, 0xffa6, 0xffa3, 0xff9f, 0xff9b, 0xff98,
-        0xff94, 0xff90, 0xff8c, 0xff88, 0xff84, 0xff80, 0xff7b, 0xff77, 0xff73, 0xff6f, 0xff6b,
-        0xff67, 0xff64, 0xff60, 0xff5d, 0xff59, 0xff56, 0xff53, 0xff50, 0xff4e, 0xff4b, 0xff49,
-        0xff47, 0xff46, 0xff44, 0xff43, 0xff42, 0xff41, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40,
-        0xff40, 0xff40, 0xff41, 0xff41, 0xff42, 0xff42, 0xff43, 0xff44, 0xff44, 0xff45, 0xff46,
-        0xff46, 0xff47, 0xff47, 0xff47, 0xff47, 0xff47, 0xff47, 0xff46, 0xff45, 0xff44, 0xff43,
-        0xff42, 0xff40, 0xff3e, 0xff3c, 0xff39, 0xff36, 0xff33, 0xff30, 0xff2c, 0xff29, 0xff25,
-        0xff21, 0xff1c, 0xff18, 0xff13, 0xff0f, 0xff0a, 0xff05, 0xff00, 0xfefb, 0xfef6, 0xfef1,
-        0xfeec, 0xfee7, 0xfee3, 0xfede, 0xfeda, 0xfed6, 0xfed2, 0xfece, 0xfeca, 0xfec7, 0xfec4,
-        0xfec1, 0xfebf, 0xfebd, 0xfebb, 0xfeba, 0xfeb9, 0xfeb8, 0xfeb8, 0xfeb7, 0xfeb8, 0xfeb8,
-        0xfeb9, 0xfeba, 0xfebb, 0xfebd, 0xfebf, 0xfec0, 0xfec2, 0xfec5, 0xfec7, 0xfec9, 0xfecc,
-        0xfece, 0xfed0, 0xfed2, 0xfed4, 0xfed6, 0xfed8, 0xfed9, 0xfeda, 0xfedb, 0xfedc, 0xfedc,
-        0xfedc, 0xfedb, 0xfeda, 0xfed8, 0xfed6, 0xfed4, 0xfed1, 0xfecd, 0xfeca, 0xfec5, 0xfec0,
-        0xfebb, 0xfeb5, 0xfeaf, 0xfea8, 0xfea1, 0xfe9a, 0xfe92, 0xfe8a, 0xfe81, 0xfe79, 0xfe70,
-        0xfe68, 0xfe5f, 0xfe56, 0xfe4e, 0xfe45, 0xfe3d, 0xfe35, 0xfe2d, 0xfe26, 0xfe1f, 0xfe19,
-        0xfe13, 0xfe0e, 0xfe0a, 0xfe07, 0xfe04, 0xfe02, 0xfe01, 0xfe02, 0xfe03, 0xfe05, 0xfe09,
-        0xfe0d, 0xfe13, 0xfe1a, 0xfe22, 0xfe2c, 0xfe37, 0xfe43, 0xfe50, 0xfe5e, 0xfe6e, 0xfe7f,
-        0xfe91, 0xfea4, 0xfeb8, 0xfece, 0xfee4, 0xfefb, 0xff14, 0xff2d, 0xff47, 0xff61, 0xff7c,
-        0xff98, 0xffb4, 0xffd1, 0xffed, 0x0009, 0x0027,
+        0x0009, 0x0005, 0x0001,
     },
     {
         0xffa1, 0xffb0, 0xffc0, 0xffcf, 0xffde, 0xffee, 0xfffd, 0x000b, 0x001a, 0x0029, 0x0038,
@@ -1511,36 +572,13 @@ static const int16_t oscillator_blsawtooth[10][512] PROGMEM = {
         0x0084, 0x0082, 0x0080, 0x007d, 0x007b, 0x0078, 0x0075, 0x0072, 0x006f, 0x006c, 0x0069,
         0x0066, 0x0062, 0x005f, 0x005b, 0x0058, 0x0054, 0x0050, 0x004c, 0x0048, 0x0044, 0x0040,
         0x003c, 0x0038, 0x0033, 0x002f, 0x002b, 0x0026, 0x0022, 0x001d, 0x0019, 0x0014, 0x0010,
-        0x000b, 0x0006, 0x0002, 0xfffe, 0xfffa, 0xfff5, 0xfff0, 0xffec, 0xffe7, 0xffe3, 0xffde,
-        0xffda, 0xffd5, 0xffd1, 0xffcd, 0xffc8, 0xffc4, 0xffc0, 0xffbc, 0xffb8, 0xffb4, 0xffb0,
-        0xffac, 0xffa8, 0xffa5, 0xffa1, 0xff9e, 0xff9a, 0xff97, 0xff94, 0xff91, 0xff8e, 0xff8b,
-        0xff88, 0xff85, 0xff83, 0xff80, 0xff7e, 0xff7c, 0xff79, 0xff77, 0xff75, 0xff74, 0xff72,
-        0xff70, 0xff6f, 0xff6d, 0xff6c, 0xff6b, 0xff6a, 0xff69, 0xff68, 0xff67, 0xff67, 0xff66,
-        0xff66, 0xff65, 0xff65, 0xff65, 0xff64, 0xff64, 0xff64, 0xff65, 0xff65, 0xff65, 0xff65,
-        0xff66, 0xff66, 0xff66, 0xff67, 0xff67, 0xff68, 0xff69, 0xff69, 0xff6a, 0xff6b, 0xff6b,
-        0xff6c, 0xff6d, 0xff6d, 0xff6e, 0xff6f, 0xff6f, 0xff70, 0xff71, 0xff71, 0xff72, 0xff72,
-        0xff72, 0xff73, 0xff73, 0xff73, 0xff74, 0xff74, 0xff74, 0xff74, 0xff73, 0xff73, 0xff73,
-        0xff73, 0xff72, 0xff71, 0xff71, 0xff70, 0xff6f, 0xff6e, 0xff6c, 0xff6b, 0xff6a, 0xff68,
-        0xff66, 0xff64, 0xff62, 0xff60, 0xff5e, 0xff5c, 0xff59, 0xff56, 0xff54, 0xff51, 0xff4d,
-        0xff4a, 0xff47, 0xff43, 0xff40, 0xff3c, 0xff38, 0xff34, 0xff2f, 0xff2b, 0xff27, 0xff22,
-        0xff1d, 0xff18, 0xff14, 0xff0e, 0xff09, 0xff04, 0xfeff, 0xfef9, 0xfef4, 0xfeee, 0xfee8,
-        0xfee3, 0xfedd, 0xfed7, 0xfed1, 0xfecb, 0xfec5, 0xfebf, 0xfeb8, 0xfeb2, 0xfeac, 0xfea6,
-        0xfea0, 0xfe9a, 0xfe93, 0xfe8d, 0xfe87, 0xfe81, 0xfe7b, 0xfe75, 0xfe6f, 0xfe69, 0xfe64,
-        0xfe5e, 0xfe58, 0xfe53, 0xfe4d, 0xfe48, 0xfe43, 0xfe3e, 0xfe39, 0xfe35, 0xfe30, 0xfe2c,
-        0xfe27, 0xfe23, 0xfe20, 0xfe1c, 0xfe18, 0xfe15, 0xfe12, 0xfe0f, 0xfe0d, 0xfe0b, 0xfe09,
-        0xfe07, 0xfe05, 0xfe04, 0xfe03, 0xfe02, 0xfe02, 0xfe01, 0xfe02, 0xfe02, 0xfe03, 0xfe04,
-        0xfe05, 0xfe07, 0xfe09, 0xfe0b, 0xfe0d, 0xfe10, 0xfe13, 0xfe17, 0xfe1b, 0xfe1f, 0xfe24,
-        0xfe28, 0xfe2e, 0xfe33, 0xfe39, 0xfe3f, 0xfe46, 0xfe4c, 0xfe54, 0xfe5b, 0xfe63, 0xfe6b,
-        0xfe73, 0xfe7c, 0xfe85, 0xfe8e, 0xfe98, 0xfea2, 0xfeac, 0xfeb6, 0xfec1, 0xfecc, 0xfed8,
-        0xfee3, 0xfeef, 0xfefb, 0xff07, 0xff14, 0xff20, 0xff2d, 0xff3b, 0xff48, 0xff56, 0xff63,
-        0xff71, 0xff7f, 0xff8e, 0xff9c, 0xffab, 0xffb9, 0xffc8, 0xffd7, 0xffe6, 0xfff5, 0x0003,
-        0x0012, 0x0022, 0x0031, 0x0040, 0x0050, 0x005f,
+        0x000b, 0x0006, 0x0002,
     },
 };
 #define oscillator_blsawtooth_rows 10
-#define oscillator_blsawtooth_cols 512
+#define oscillator_blsawtooth_cols 256
 
-static const uint32_t notes_phase_steps[128] = {
+static const uint32_t notes_phase_steps[128] PROGMEM = {
     0x00001653, 0x000017a7, 0x0000190f, 0x00001a8c, 0x00001c20, 0x00001dcd, 0x00001f92, 0x00002173,
     0x00002370, 0x0000258b, 0x000027c7, 0x00002a25, 0x00002ca6, 0x00002f4e, 0x0000321e, 0x00003519,
     0x00003841, 0x00003b9a, 0x00003f25, 0x000042e6, 0x000046e0, 0x00004b17, 0x00004f8f, 0x0000544a,
@@ -1560,7 +598,7 @@ static const uint32_t notes_phase_steps[128] = {
 };
 #define notes_phase_steps_len 128
 
-static const uint8_t notes_octaves[128] = {
+static const uint8_t notes_octaves[128] PROGMEM = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
     0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
     0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
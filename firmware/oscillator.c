@@ -11,9 +11,52 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include "oscillator.h"
+#if OSCILLATOR_USER_WAVETABLES
+#include "wavetable.h"
+#endif
+
+// devices with a mapped flash window (FLMAP) keep read-only data in flash when
+// built with avr-gcc 14 or newer. the wavetables are then read with plain
+// loads, that the compiler can schedule and combine, instead of lpm.
+#if defined(__AVR_HAVE_FLMAP__) && !__AVR_RODATA_IN_RAM__
+#define oscillator_wavetable_attr
+#define oscillator_wavetable_read(addr) (*(addr))
+#else
+#define oscillator_wavetable_attr PROGMEM
+#define oscillator_wavetable_read(addr) pgm_read_word(addr)
+#endif
+
+#if OSCILLATOR_POLYBLEP
+// the band-limited square and saw wavetables are not used.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-const-variable"
+#endif
+
 #include "oscillator-data.h"
 
+#if OSCILLATOR_POLYBLEP
+#pragma GCC diagnostic pop
+#endif
+
+// waveform value for no waveform set yet, or no pending change.
+#define waveform_none ((oscillator_waveform_t) 0xff)
+
+// fractional part of the phase step ratio for each step of a semitone, as
+// 0.16 fixed point: round(65536 * (2 ^ (i / (12 * 64)) - 1))
+static_assert(oscillator_bend_steps == 64, "fine tune table must match the bend steps");
+static const uint16_t fine_tune[oscillator_bend_steps] PROGMEM = {
+    0x0000, 0x003b, 0x0076, 0x00b2, 0x00ed, 0x0128, 0x0164, 0x019f,
+    0x01db, 0x0217, 0x0252, 0x028e, 0x02ca, 0x0305, 0x0341, 0x037d,
+    0x03b9, 0x03f5, 0x0431, 0x046e, 0x04aa, 0x04e6, 0x0522, 0x055f,
+    0x059b, 0x05d8, 0x0614, 0x0651, 0x068d, 0x06ca, 0x0707, 0x0743,
+    0x0780, 0x07bd, 0x07fa, 0x0837, 0x0874, 0x08b1, 0x08ef, 0x092c,
+    0x0969, 0x09a7, 0x09e4, 0x0a21, 0x0a5f, 0x0a9c, 0x0ada, 0x0b18,
+    0x0b56, 0x0b93, 0x0bd1, 0x0c0f, 0x0c4d, 0x0c8b, 0x0cc9, 0x0d07,
+    0x0d45, 0x0d84, 0x0dc2, 0x0e00, 0x0e3f, 0x0e7d, 0x0ebc, 0x0efa,
+};
+
 
 void
 oscillator_init(oscillator_t *o)
@@ -23,17 +66,44 @@ oscillator_init(oscillator_t *o)
 
     o->_initialized = true;
     o->_phase.data = 0;
-    o->_waveform = OSCILLATOR_WAVEFORM__LAST;
-    o->_waveform_next = OSCILLATOR_WAVEFORM__LAST;
+    o->_waveform = waveform_none;
+    o->_waveform_next = waveform_none;
     o->_note = 0xff;
     o->_note_next = 0xff;
+    o->_bend = 0;
+    o->_pitch_mod = oscillator_pitch_mod_unity;
+    o->_portamento = false;
+    o->_glide_rate = 0;
+    o->_glide = 0;
+    o->_noise = 0xace1;
+    o->_pulse_width = 0;
+    o->_pulse_width_mod = 0;
+    o->_sub_level = 0;
+    o->_sub_mask = 1 << OSCILLATOR_SUB_OCTAVE_ONE;
+    o->_sub_count = 0;
+    o->_mod_phase.data = 0;
+    o->_fm_ratio = 1;
+    o->_fm_index = 0;
+    o->_fm_envelope = false;
+    o->_fm_level = 0xff;
+    o->_sync_phase.data = 0;
+    o->_sync_interval = 0;
+    o->_sync_step = 0;
+    o->_step = 0;
+    o->_dt = 0;
+    o->_dt_inv = 0;
+    o->_table = oscillator_sine;
+    o->_table_next = oscillator_sine;
+    o->_storage = OSCILLATOR_STORAGE_QUARTER_CENTERED;
+    o->_storage_next = OSCILLATOR_STORAGE_QUARTER_CENTERED;
+    o->_blend = 0;
 }
 
 
 bool
 oscillator_set_waveform(oscillator_t *o, oscillator_waveform_t wf)
 {
-    if (o != NULL && o->_initialized && o->_waveform != wf) {
+    if (o != NULL && o->_initialized && o->_waveform != wf && wf < oscillator_waveforms) {
         o->_waveform_next = wf;
         return true;
     }
@@ -49,75 +119,761 @@ oscillator_set_note(oscillator_t *o, uint8_t n)
 }
 
 
-static bool
-phase_step(oscillator_phase_t *p, uint8_t idx)
+// samples per cycle of the wavetables. the generated tables are trimmed to the
+// part that is stored.
+#define wavetable_len 0x200
+
+static_assert(oscillator_sine_len == wavetable_len / 4 + 1, "sine must be stored as a quarter plus the middle sample");
+static_assert(oscillator_blsquare_cols == wavetable_len / 4, "square must be stored as a quarter");
+static_assert(oscillator_bltriangle_cols == wavetable_len / 4 + 1, "triangle must be stored as a quarter plus the middle sample");
+static_assert(oscillator_blsawtooth_cols == wavetable_len / 2, "saw must be stored as a half");
+
+#if OSCILLATOR_USER_WAVETABLES
+static_assert(wavetable_samples == wavetable_len, "user wavetables must be a full cycle");
+static_assert(wavetable_levels == oscillator_blsquare_rows, "user wavetables must have one level per octave");
+#endif
+
+
+static inline int16_t
+interpolate(int16_t s0, int16_t s1, uint8_t frac)
+{
+    int16_t diff = s1 - s0;
+#ifdef __AVR__
+    int16_t rv;
+    uint8_t tmp;
+    asm volatile (
+        "mul %A2, %3"   "\n\t"  // $result = diff[l] * frac (unsigned multiplication)
+        "mov %1, r1"    "\n\t"  // tmp = $result[h]
+        "mulsu %B2, %3" "\n\t"  // $result = diff[h] * frac (signed * unsigned multiplication)
+        "movw %A0, r0"  "\n\t"  // rv = $result
+        "clr r1"        "\n\t"  // $r1 = 0 (avr-libc convention)
+        "add %A0, %1"   "\n\t"  // rv[l] += tmp
+        "adc %B0, r1"   "\n\t"  // rv[h] += $carry
+        : "=&r" (rv), "=&r" (tmp)
+        : "a" (diff), "a" (frac)
+    );
+    return s0 + rv;
+#else
+    return s0 + (int16_t) (((int32_t) diff * frac) >> 8);
+#endif
+}
+
+
+static inline int16_t
+read_wavetable(const int16_t *table, oscillator_storage_t st, uint16_t i)
 {
-    if (p == NULL)
-        return false;
+    bool negate = false;
 
-    p->data += notes_phase_steps[idx];
-    if (p->pint >= oscillator_sine_len) {
-        p->pint -= oscillator_sine_len;
-        return true;
+    switch (st) {
+    case OSCILLATOR_STORAGE_HALF:
+        if (i & (wavetable_len / 2)) {
+            i ^= wavetable_len - 1;
+            negate = true;
+        }
+        break;
+
+    case OSCILLATOR_STORAGE_QUARTER:
+        negate = i & (wavetable_len / 2);
+        i &= wavetable_len / 2 - 1;
+        if (i & (wavetable_len / 4))
+            i ^= wavetable_len / 2 - 1;
+        break;
+
+    case OSCILLATOR_STORAGE_QUARTER_CENTERED:
+        negate = i & (wavetable_len / 2);
+        i &= wavetable_len / 2 - 1;
+        if (i > wavetable_len / 4)
+            i = wavetable_len / 2 - i;
+        break;
+
+#if OSCILLATOR_USER_WAVETABLES
+    case OSCILLATOR_STORAGE_USER:
+        // read from the mapped flash, scaled to the range of the builtin
+        // wavetables.
+        return ((const int8_t*) table)[i] * 4;
+#endif
+
+    case OSCILLATOR_STORAGE_FULL:
+    default:
+        break;
     }
-    return false;
+
+    int16_t rv = oscillator_wavetable_read(&(table[i]));
+    return negate ? -rv : rv;
 }
 
 
-int16_t
-oscillator_get_sample(oscillator_t *o)
+static inline int16_t
+read_sample(const int16_t *table, oscillator_storage_t st, oscillator_phase_t phase)
+{
+#if OSCILLATOR_INTERPOLATION
+    // blend with the next sample, using the top 8 bits of the fraction
+    return interpolate(
+        read_wavetable(table, st, phase.pint),
+        read_wavetable(table, st, (phase.pint + 1) & (wavetable_len - 1)),
+        phase.pfrac >> 8);
+#else
+    return read_wavetable(table, st, phase.pint);
+#endif
+}
+
+
+// noise takes a new random value 32 times per cycle, so the note sets how
+// bright it is. from around A3 up it changes every sample, and is white.
+#define noise_clock_shift 4
+
+
+static inline uint16_t
+noise_next(uint16_t x)
+{
+    // xorshift with the 7, 9, 8 shifts of a maximal length 16 bits sequence.
+#ifdef __AVR__
+    uint8_t t0, t1;
+    asm volatile (
+        "mov %1, %A0"   "\n\t"  // t1 = x[l]
+        "mov %2, %B0"   "\n\t"  // t0 = x[h]
+        "lsr %2"        "\n\t"  // $carry = x[h] & 1
+        "ror %1"        "\n\t"  // t1 = (x << 7)[h], $carry = x[l] & 1
+        "clr %2"        "\n\t"  // t0 = 0 (keeps $carry)
+        "ror %2"        "\n\t"  // t0 = (x << 7)[l]
+        "eor %A0, %2"   "\n\t"  // x ^= x << 7
+        "eor %B0, %1"   "\n\t"
+        "mov %2, %B0"   "\n\t"  // t0 = x[h]
+        "lsr %2"        "\n\t"  // t0 = x >> 9
+        "eor %A0, %2"   "\n\t"  // x ^= x >> 9
+        "eor %B0, %A0"  "\n\t"  // x ^= x << 8
+        : "+r" (x), "=&r" (t1), "=&r" (t0)
+    );
+    return x;
+#else
+    x ^= x << 7;
+    x ^= x >> 9;
+    x ^= x << 8;
+    return x;
+#endif
+}
+
+
+static inline int16_t
+noise_sample(uint16_t x)
+{
+    // -512 to 511, folded to the -511 to 511 range of the wavetables.
+    int16_t v = ((int16_t) x) >> 6;
+    if (v < 0)
+        v++;
+    return v;
+}
+
+
+static inline int32_t
+fm_offset(int16_t mod, uint8_t index)
+{
+    // phase offset of the carrier, in 1/128 wavetable samples. with a full
+    // index it spans about 2 cycles in each direction.
+#ifdef __AVR__
+    int32_t rv;
+    asm volatile (
+        "mul %A1, %2"   "\n\t"  // $result = mod[l] * index (unsigned multiplication)
+        "movw %A0, r0"  "\n\t"  // rv[l] = $result
+        "mulsu %B1, %2" "\n\t"  // $result = mod[h] * index (signed * unsigned multiplication)
+        "add %B0, r0"   "\n\t"  // rv[h] += $result
+        "mov %C0, r1"   "\n\t"
+        "clr r1"        "\n\t"  // $r1 = 0 (avr-libc convention)
+        "adc %C0, r1"   "\n\t"
+        "clr %D0"       "\n\t"  // sign extend
+        "sbrc %C0, 7"   "\n\t"
+        "com %D0"       "\n\t"
+        : "=&r" (rv)
+        : "a" (mod), "a" (index)
+    );
+    return rv;
+#else
+    return (int32_t) mod * index;
+#endif
+}
+
+
+// residual of a band-limited step at the start of the cycle, in output units:
+// -(1 - t/dt)^2 right after it, and (1 - (1 - t)/dt)^2 right before it. t and
+// dt are 0.16 fixed point, and dt_inv is 2^24 / dt, so that there are no
+// divisions per sample.
+static inline int16_t
+polyblep(uint16_t t, uint16_t dt, uint32_t dt_inv)
+{
+    uint16_t u;
+    bool after = t < dt;
+    if (after)
+        u = ~(uint16_t) ((t * dt_inv) >> 8);
+    else if ((uint16_t) -t < dt)
+        u = ~(uint16_t) (((uint16_t) -t * dt_inv) >> 8);
+    else
+        return 0;
+
+    int16_t rv = ((uint32_t) u * u) >> 23;
+    return after ? -rv : rv;
+}
+
+
+static inline int16_t
+render_polyblep(oscillator_waveform_t wf, oscillator_phase_t phase, uint16_t dt, uint32_t dt_inv, uint16_t width)
+{
+    // position inside the cycle, as 0.16 fixed point
+    uint16_t t = phase.data / wavetable_len;
+
+    if (wf == OSCILLATOR_WAVEFORM_SAW) {
+        // -512 to 511, folded to the -511 to 511 range of the wavetables.
+        int16_t v = ((int16_t) (t ^ 0x8000)) >> 6;
+        if (v < 0)
+            v++;
+        return v - polyblep(t, dt, dt_inv);
+    }
+
+    // square is a pulse with half of the cycle as width.
+    return (t < width ? 0x1ff : -0x1ff) + polyblep(t, dt, dt_inv) - polyblep(t - width, dt, dt_inv);
+}
+
+
+static const int16_t*
+get_table(oscillator_waveform_t wf, uint8_t octave, oscillator_storage_t *st)
+{
+    if (wf == OSCILLATOR_WAVEFORM_NOISE) {
+        *st = OSCILLATOR_STORAGE_NOISE;
+        return NULL;
+    }
+
+    // the carrier is read with the modulated phase.
+    if (wf == OSCILLATOR_WAVEFORM_FM) {
+        *st = OSCILLATOR_STORAGE_FM;
+        return NULL;
+    }
+
+    // the pulse has no wavetables, its width changes with every block.
+#if OSCILLATOR_POLYBLEP
+    if (wf == OSCILLATOR_WAVEFORM_PULSE || wf == OSCILLATOR_WAVEFORM_SQUARE || wf == OSCILLATOR_WAVEFORM_SAW) {
+#else
+    if (wf == OSCILLATOR_WAVEFORM_PULSE) {
+#endif
+        *st = OSCILLATOR_STORAGE_POLYBLEP;
+        return NULL;
+    }
+
+    if (octave >= oscillator_blsquare_rows) {
+        *st = OSCILLATOR_STORAGE_QUARTER_CENTERED;
+        return oscillator_sine;
+    }
+
+#if OSCILLATOR_USER_WAVETABLES
+    if (wf >= OSCILLATOR_WAVEFORM__LAST) {
+        *st = OSCILLATOR_STORAGE_USER;
+        return (const int16_t*) wavetable_get(wf - OSCILLATOR_WAVEFORM__LAST, octave);
+    }
+#endif
+
+    switch (wf) {
+    case OSCILLATOR_WAVEFORM_SQUARE:
+        *st = OSCILLATOR_STORAGE_QUARTER;
+        return oscillator_blsquare[octave];
+
+    case OSCILLATOR_WAVEFORM_TRIANGLE:
+        *st = OSCILLATOR_STORAGE_QUARTER_CENTERED;
+        return oscillator_bltriangle[octave];
+
+    case OSCILLATOR_WAVEFORM_SAW:
+        *st = OSCILLATOR_STORAGE_HALF;
+        return oscillator_blsawtooth[octave];
+
+    case OSCILLATOR_WAVEFORM_SINE:
+    default:  // oscillator_set_waveform does not accept invalid waveforms
+        *st = OSCILLATOR_STORAGE_QUARTER_CENTERED;
+        return oscillator_sine;
+    }
+}
+
+
+static inline int16_t
+clamp_pitch(int16_t pitch)
 {
-    if (o == NULL || !o->_initialized)
+    if (pitch < 0)
         return 0;
+    if (pitch > (notes_phase_steps_len - 1) * oscillator_bend_steps)
+        return (notes_phase_steps_len - 1) * oscillator_bend_steps;
+    return pitch;
+}
+
+
+static uint32_t
+get_step(int16_t pitch)
+{
+    uint8_t note = pitch / oscillator_bend_steps;
+    uint8_t fine = pitch % oscillator_bend_steps;
+
+    // step * (1 + fine_tune), split to fit the 32 bits multiplications.
+    uint32_t rv = pgm_read_dword(&notes_phase_steps[note]);
+    if (fine != 0) {
+        uint16_t f = pgm_read_word(&fine_tune[fine]);
+        rv += (rv >> 16) * f + (((rv & 0xffff) * f) >> 16);
+    }
+    return rv;
+}
+
+
+static void
+set_pitch(oscillator_t *o)
+{
+    // the state of the oscillator_t pointer is checked by the caller.
+
+    int16_t pitch = clamp_pitch((int16_t) (o->_glide >> oscillator_glide_frac_bits) + o->_bend);
+    o->_step = get_step(pitch);
+
+    // with hard sync, the waveform is read at the interval above the note,
+    // and restarted on every cycle of the note. the tables are selected for
+    // the pitch that is read.
+    o->_sync_step = 0;
+    if (o->_sync_interval != 0) {
+        pitch = clamp_pitch(pitch + o->_sync_interval);
+        o->_sync_step = get_step(pitch);
+    }
+
+    uint8_t note = pitch / oscillator_bend_steps;
+    uint8_t octave = pgm_read_byte(&notes_octaves[note]);
+    o->_table = get_table(o->_waveform, octave, &o->_storage);
+
+    // the division is only needed by the waveforms generated with polyblep.
+    if (o->_storage == OSCILLATOR_STORAGE_POLYBLEP) {
+        o->_dt = (o->_sync_step != 0 ? o->_sync_step : o->_step) / wavetable_len;
+        o->_dt_inv = (1UL << 24) / o->_dt;
+    }
+
+    o->_table_next = o->_table;
+    o->_storage_next = o->_storage;
+    o->_blend = 0;
+
+#if OSCILLATOR_CROSSFADE
+    // octaves start at multiples of 12 notes. the next octave table has fewer
+    // harmonics, so blending towards it never aliases.
+    oscillator_storage_t st;
+    const int16_t *next = get_table(o->_waveform, octave + 1, &st);
+    if (next != o->_table) {
+        o->_table_next = next;
+        o->_storage_next = st;
+        o->_blend = (uint16_t) (pitch - 12 * oscillator_bend_steps * octave) / (12 * oscillator_bend_steps / 256);
+    }
+#endif
+}
+
+
+void
+oscillator_set_bend(oscillator_t *o, int16_t b)
+{
+    if (o == NULL || !o->_initialized || o->_bend == b)
+        return;
+
+    // unlike note changes, the new phase step applies right away, so bends
+    // are smooth.
+    o->_bend = b;
+    if (o->_note < notes_phase_steps_len)
+        set_pitch(o);
+}
+
+
+bool
+oscillator_set_portamento(oscillator_t *o, bool enable)
+{
+    if (o == NULL || !o->_initialized || o->_portamento == enable)
+        return false;
+
+    o->_portamento = enable;
+    return true;
+}
+
+
+bool
+oscillator_set_portamento_time(oscillator_t *o, uint8_t t)
+{
+    // glide rate per sample for each sixteenth of a doubling of the glide
+    // time, starting from 10ms per octave, in bend steps with 15 fractional
+    // bits: round(12 * 64 * 2 ^ 15 / (0.01 * 48000 * 2 ^ (i / 16)))
+    static_assert(oscillator_glide_frac_bits == 15, "glide rate table must match the glide fractional bits");
+    static const uint16_t glide_rates[16] PROGMEM = {
+        0xcccd, 0xc41e, 0xbbcd, 0xb3d7, 0xac37, 0xa4ea, 0x9dec, 0x973a,
+        0x90d1, 0x8aad, 0x84cc, 0x7f2b, 0x79c6, 0x749d, 0x6fab, 0x6aef,
+    };
+
+    if (o == NULL || !o->_initialized || t > 0x7f)
+        return false;
+
+    // from 10ms to about 2.4s per octave.
+    uint16_t rate = pgm_read_word(&glide_rates[t & 0xf]) >> (t >> 4);
+    if (o->_glide_rate == rate)
+        return false;
+
+    o->_glide_rate = rate;
+    return true;
+}
+
+
+static void
+glide(oscillator_t *o, uint8_t n)
+{
+    // the state of the oscillator_t pointer is checked by the caller.
+
+    uint32_t target = (uint32_t) o->_note * oscillator_bend_steps << oscillator_glide_frac_bits;
+    if (o->_glide == target)
+        return;
+
+    uint16_t prev = o->_glide >> oscillator_glide_frac_bits;
+    uint32_t delta = (uint32_t) o->_glide_rate * n;
+
+    if (!o->_portamento)  // disabled while gliding
+        o->_glide = target;
+    else if (o->_glide < target)
+        o->_glide = target - o->_glide > delta ? o->_glide + delta : target;
+    else
+        o->_glide = o->_glide - target > delta ? o->_glide - delta : target;
+
+    // the phase step is only recomputed when the pitch reaches the next bend
+    // step, at most once per block.
+    if ((uint16_t) (o->_glide >> oscillator_glide_frac_bits) != prev)
+        set_pitch(o);
+}
+
+
+bool
+oscillator_set_pulse_width(oscillator_t *o, uint8_t w)
+{
+    if (o == NULL || !o->_initialized || o->_pulse_width == w || w > 0x7f)
+        return false;
+
+    o->_pulse_width = w;
+    return true;
+}
+
+
+void
+oscillator_set_pulse_width_mod(oscillator_t *o, int8_t mod)
+{
+    if (o != NULL && o->_initialized)
+        o->_pulse_width_mod = mod;
+}
+
+
+static uint16_t
+get_pulse_width(oscillator_t *o)
+{
+    // the state of the oscillator_t pointer is checked by the caller.
+
+    if (o->_waveform != OSCILLATOR_WAVEFORM_PULSE)
+        return 0x8000;
+
+    // from half of the cycle down to about 3.5% of it, as 0.16 fixed point.
+    int16_t w = o->_pulse_width + o->_pulse_width_mod;
+    if (w < 0)
+        w = 0;
+    else if (w > 0x7f)
+        w = 0x7f;
+    return 0x8000 - (uint16_t) w * 0xf0;
+}
+
+
+bool
+oscillator_set_sub_level(oscillator_t *o, uint8_t l)
+{
+    if (o == NULL || !o->_initialized || o->_sub_level == l || l > 0x7f)
+        return false;
+
+    o->_sub_level = l;
+    return true;
+}
+
+
+bool
+oscillator_set_sub_octave(oscillator_t *o, oscillator_sub_octave_t so)
+{
+    if (o == NULL || !o->_initialized || so >= OSCILLATOR_SUB_OCTAVE__LAST || o->_sub_mask == 1 << so)
+        return false;
+
+    o->_sub_mask = 1 << so;
+    return true;
+}
+
+
+bool
+oscillator_set_fm_ratio(oscillator_t *o, uint8_t r)
+{
+    if (o == NULL || !o->_initialized || r >= oscillator_fm_ratios || o->_fm_ratio == r + 1)
+        return false;
+
+    // in halves of the note.
+    o->_fm_ratio = r + 1;
+    return true;
+}
+
+
+bool
+oscillator_set_fm_index(oscillator_t *o, uint8_t i)
+{
+    if (o == NULL || !o->_initialized || o->_fm_index == i || i > 0x7f)
+        return false;
+
+    o->_fm_index = i;
+    return true;
+}
+
+
+bool
+oscillator_set_fm_envelope(oscillator_t *o, bool enable)
+{
+    if (o == NULL || !o->_initialized || o->_fm_envelope == enable)
+        return false;
+
+    o->_fm_envelope = enable;
+    return true;
+}
+
+
+void
+oscillator_set_fm_level(oscillator_t *o, uint8_t level)
+{
+    if (o != NULL && o->_initialized)
+        o->_fm_level = level;
+}
+
+
+static inline uint8_t
+get_fm_index(oscillator_t *o)
+{
+    // the state of the oscillator_t pointer is checked by the caller.
+
+    uint8_t rv = o->_fm_index << 1;
+    if (o->_fm_envelope)
+        rv = ((uint16_t) rv * o->_fm_level) >> 8;
+    return rv;
+}
+
+
+bool
+oscillator_set_sync_interval(oscillator_t *o, uint8_t interval)
+{
+    if (o == NULL || !o->_initialized || interval > 0x7f)
+        return false;
+
+    // up to about 2 octaves, in 3/16 semitone steps.
+    int16_t i = (int16_t) interval * (2 * 12 * oscillator_bend_steps / 128);
+    if (o->_sync_interval == i)
+        return false;
+
+    // like bends, applies right away, so sweeps are smooth.
+    o->_sync_interval = i;
+    if (o->_note < notes_phase_steps_len)
+        set_pitch(o);
+    return true;
+}
+
+
+void
+oscillator_set_pitch_mod(oscillator_t *o, uint16_t ratio)
+{
+    if (o != NULL && o->_initialized)
+        o->_pitch_mod = ratio;
+}
+
+
+uint16_t
+oscillator_get_pitch_mod_ratio(int16_t steps)
+{
+    // 2 ^ (i / 12) for i from -2 to 1 semitones, as 1.15 fixed point
+    static const uint16_t semitones[] PROGMEM = {0x7209, 0x78d1, 0x8000, 0x879c};
+
+    if (steps < -2 * oscillator_bend_steps)
+        steps = -2 * oscillator_bend_steps;
+    else if (steps > 2 * oscillator_bend_steps - 1)
+        steps = 2 * oscillator_bend_steps - 1;
+
+    uint8_t i = (steps + 2 * oscillator_bend_steps) / oscillator_bend_steps;
+    uint8_t fine = (steps + 2 * oscillator_bend_steps) % oscillator_bend_steps;
+
+    uint16_t rv = pgm_read_word(&semitones[i]);
+    if (fine != 0)
+        rv += ((uint32_t) rv * pgm_read_word(&fine_tune[fine])) >> 16;
+    return rv;
+}
+
+
+static inline uint32_t
+apply_pitch_mod(uint32_t step, uint16_t ratio)
+{
+    if (ratio == oscillator_pitch_mod_unity)
+        return step;
+
+    // step * ratio >> 15, split to fit the 32 bits multiplications.
+    return (((step >> 16) * ratio) << 1) + (((step & 0xffff) * ratio) >> 15);
+}
+
+
+int16_t
+oscillator_get_sine(uint16_t phase)
+{
+    // phase is the position inside the cycle, as 0.16 fixed point. the
+    // samples are not interpolated, this is meant for control rate uses.
+    return read_wavetable(oscillator_sine, OSCILLATOR_STORAGE_QUARTER_CENTERED, phase / (0x10000 / wavetable_len));
+}
+
+
+void
+oscillator_render_block(oscillator_t *o, int16_t *buf, uint8_t n)
+{
+    if (o == NULL || !o->_initialized) {
+        memset(buf, 0, n * sizeof(int16_t));
+        return;
+    }
 
     if (o->_note >= notes_phase_steps_len) {  // not running
-        if (o->_note_next >= notes_phase_steps_len || o->_waveform_next >= OSCILLATOR_WAVEFORM__LAST)  // no note to play yet
-            return 0;
+        if (o->_note_next >= notes_phase_steps_len || o->_waveform_next == waveform_none) {  // no note to play yet
+            memset(buf, 0, n * sizeof(int16_t));
+            return;
+        }
         o->_note = o->_note_next;
         o->_note_next = 0xff;
+        o->_glide = (uint32_t) o->_note * oscillator_bend_steps << oscillator_glide_frac_bits;
         o->_waveform = o->_waveform_next;
-        o->_waveform_next = OSCILLATOR_WAVEFORM__LAST;
-        o->_phase.data = 0;
+        o->_waveform_next = waveform_none;
+        set_pitch(o);
+
+        // one step before the end of a cycle, so the first sample is the
+        // start of the next one. same for the sub-oscillator.
+        o->_phase.data = ((uint32_t) wavetable_len << 16) - apply_pitch_mod(o->_step, o->_pitch_mod);
+        o->_sub_count = 0xff;
+        o->_mod_phase.data = 0;
+        o->_sync_phase.data = 0;
     }
-    else if (phase_step(&o->_phase, o->_note)) {
-        if (o->_note_next < notes_phase_steps_len) {  // new note to play
+    else {
+        // with portamento, new notes don't wait for the end of the cycle, the
+        // pitch glides towards them once per block instead.
+        if (o->_portamento && o->_note_next < notes_phase_steps_len) {
             o->_note = o->_note_next;
             o->_note_next = 0xff;
         }
-        if (o->_waveform_next < OSCILLATOR_WAVEFORM__LAST) {  // new waveform to set
-            o->_waveform = o->_waveform_next;
-            o->_waveform_next = OSCILLATOR_WAVEFORM__LAST;
-        }
+        glide(o, n);
     }
 
-    const int16_t *table;
+    // tables and phase step only change at the end of a cycle, on bends, or
+    // with the pitch modulation and portamento between blocks, keep them out
+    // of the inner loop.
+    const int16_t *table = o->_table;
+    const int16_t *table_next = o->_table_next;
+    oscillator_storage_t storage = o->_storage;
+    oscillator_storage_t storage_next = o->_storage_next;
+    uint8_t blend = o->_blend;
+    uint32_t step = apply_pitch_mod(o->_step, o->_pitch_mod);
+    // the polyblep width ignores the pitch modulation, that is small enough
+    // to not matter.
+    uint16_t dt = o->_dt;
+    uint32_t dt_inv = o->_dt_inv;
+    uint16_t width = get_pulse_width(o);
+    oscillator_phase_t phase = o->_phase;
+    uint16_t noise = o->_noise;
+    uint8_t noise_clock = phase.pint >> noise_clock_shift;
+    uint8_t sub_level = o->_sub_level;
+    uint8_t sub_mask = o->_sub_mask;
+    uint8_t sub_count = o->_sub_count;
+    oscillator_phase_t mod_phase = o->_mod_phase;
+    uint32_t mod_step = (step >> 1) * o->_fm_ratio;
+    uint8_t fm_index = get_fm_index(o);
+    oscillator_phase_t sync_phase = o->_sync_phase;
+    uint32_t sync_step = apply_pitch_mod(o->_sync_step, o->_pitch_mod);
 
-    uint8_t octave = notes_octaves[o->_note];
-    if (octave >= oscillator_blsquare_rows) {
-        table = oscillator_sine;
-    }
-    else {
-        switch (o->_waveform) {
-        case OSCILLATOR_WAVEFORM_SQUARE:
-            table = oscillator_blsquare[octave];
-            break;
+    for (uint8_t i = 0; i < n; i++) {
+        phase.data += step;
+        if (phase.pint >= wavetable_len) {
+            phase.pint -= wavetable_len;
+            sub_count++;
+            sync_phase.data = 0;
 
-        case OSCILLATOR_WAVEFORM_SINE:
-            table = oscillator_sine;
-            break;
+            bool changed = false;
+            if (o->_note_next < notes_phase_steps_len) {  // new note to play
+                o->_note = o->_note_next;
+                o->_note_next = 0xff;
+                o->_glide = (uint32_t) o->_note * oscillator_bend_steps << oscillator_glide_frac_bits;
+                changed = true;
+            }
+            if (o->_waveform_next != waveform_none) {  // new waveform to set
+                o->_waveform = o->_waveform_next;
+                o->_waveform_next = waveform_none;
+                changed = true;
+            }
+            if (changed) {
+                set_pitch(o);
+                table = o->_table;
+                table_next = o->_table_next;
+                storage = o->_storage;
+                storage_next = o->_storage_next;
+                blend = o->_blend;
+                step = apply_pitch_mod(o->_step, o->_pitch_mod);
+                dt = o->_dt;
+                dt_inv = o->_dt_inv;
+                width = get_pulse_width(o);
+                mod_step = (step >> 1) * o->_fm_ratio;
+                sync_step = apply_pitch_mod(o->_sync_step, o->_pitch_mod);
+            }
+        }
 
-        case OSCILLATOR_WAVEFORM_TRIANGLE:
-            table = oscillator_bltriangle[octave];
-            break;
+        // the waveform is read with the synced phase, if any.
+        oscillator_phase_t p = phase;
+        if (sync_step != 0) {
+            p = sync_phase;
+            sync_phase.data += sync_step;
+            if (sync_phase.pint >= wavetable_len)
+                sync_phase.pint -= wavetable_len;
+        }
 
-        case OSCILLATOR_WAVEFORM_SAW:
-            table = oscillator_blsawtooth[octave];
-            break;
+        int16_t sample;
+        if (table != NULL) {
+            sample = read_sample(table, storage, p);
+            if (blend)
+                sample = interpolate(sample, read_sample(table_next, storage_next, p), blend);
+        }
+        else if (storage == OSCILLATOR_STORAGE_FM) {
+            mod_phase.data += mod_step;
+            mod_phase.pint &= wavetable_len - 1;
+            int16_t mod = read_wavetable(oscillator_sine, OSCILLATOR_STORAGE_QUARTER_CENTERED, mod_phase.pint);
 
-        default:
-            return 0;
+            oscillator_phase_t pm = p;
+            pm.data += (uint32_t) fm_offset(mod, fm_index) << 9;
+            pm.pint &= wavetable_len - 1;
+            sample = read_sample(oscillator_sine, OSCILLATOR_STORAGE_QUARTER_CENTERED, pm);
+        }
+        else if (storage == OSCILLATOR_STORAGE_NOISE) {
+            uint8_t clock = p.pint >> noise_clock_shift;
+            if (clock != noise_clock) {
+                noise_clock = clock;
+                noise = noise_next(noise);
+            }
+            sample = noise_sample(noise);
         }
+        else {
+            sample = render_polyblep(o->_waveform, p, dt, dt_inv, width);
+        }
+
+        // the sub-oscillator square flips every one or two cycles, and is
+        // mixed up to half of the output.
+        if (sub_level)
+            sample = interpolate(sample, (sub_count & sub_mask) ? -0x1ff : 0x1ff, sub_level);
+
+        buf[i] = sample;
     }
 
-    return pgm_read_word(&(table[o->_phase.pint]));
+    o->_phase = phase;
+    o->_noise = noise;
+    o->_sub_count = sub_count;
+    o->_mod_phase = mod_phase;
+    o->_sync_phase = sync_phase;
+}
+
+
+int16_t
+oscillator_get_sample(oscillator_t *o)
+{
+    int16_t rv;
+    oscillator_render_block(o, &rv, 1);
+    return rv;
 }
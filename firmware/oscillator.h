@@ -11,6 +11,46 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// wavetable samples can be linearly interpolated using the phase fraction,
+// instead of truncated.
+#ifndef OSCILLATOR_INTERPOLATION
+#define OSCILLATOR_INTERPOLATION 1
+#endif
+
+// the band-limited wavetables of the current and next octaves can be blended,
+// using the position of the note inside the octave, to avoid timbre jumps at
+// octave boundaries.
+#ifndef OSCILLATOR_CROSSFADE
+#define OSCILLATOR_CROSSFADE 1
+#endif
+
+// square and saw can be generated on the fly, correcting the discontinuities
+// with polyblep, instead of read from the band-limited wavetables.
+#ifndef OSCILLATOR_POLYBLEP
+#define OSCILLATOR_POLYBLEP 0
+#endif
+
+// waveforms can be read from wavetables uploaded by the user to the flash, in
+// up to 3 slots, after the builtin ones.
+#ifndef OSCILLATOR_USER_WAVETABLES
+#define OSCILLATOR_USER_WAVETABLES 0
+#endif
+
+#if OSCILLATOR_USER_WAVETABLES > 3
+#error "OSCILLATOR_USER_WAVETABLES must be at most 3"
+#endif
+
+// pitch bend is set in fractions of a semitone.
+#define oscillator_bend_steps 64
+
+// pitch modulation multiplies the phase step by a 1.15 fixed point ratio, and
+// covers up to 2 semitones in each direction.
+#define oscillator_pitch_mod_unity 0x8000
+
+// portamento glides the pitch of the oscillator linearly in bend steps, that
+// is exponentially in frequency, with the given number of fractional bits.
+#define oscillator_glide_frac_bits 15
+
 typedef union {
     uint32_t data;
     struct {
@@ -24,9 +64,40 @@ typedef enum {
     OSCILLATOR_WAVEFORM_SINE,
     OSCILLATOR_WAVEFORM_TRIANGLE,
     OSCILLATOR_WAVEFORM_SAW,
+    OSCILLATOR_WAVEFORM_NOISE,
+    OSCILLATOR_WAVEFORM_PULSE,
+    OSCILLATOR_WAVEFORM_FM,
     OSCILLATOR_WAVEFORM__LAST,
 } oscillator_waveform_t;
 
+// builtin waveforms plus user wavetable slots.
+#define oscillator_waveforms (OSCILLATOR_WAVEFORM__LAST + OSCILLATOR_USER_WAVETABLES)
+
+// wavetables are symmetric, and only the part needed to rebuild the whole
+// cycle is stored.
+typedef enum {
+    OSCILLATOR_STORAGE_FULL,
+    OSCILLATOR_STORAGE_HALF,              // second half reversed and negated
+    OSCILLATOR_STORAGE_QUARTER,           // second quarter reversed, second half negated
+    OSCILLATOR_STORAGE_QUARTER_CENTERED,  // same, reversed around the middle sample
+    OSCILLATOR_STORAGE_USER,              // full cycle of 8 bits samples
+    OSCILLATOR_STORAGE_NOISE,             // no table, generated by a xorshift
+    OSCILLATOR_STORAGE_POLYBLEP,          // no table, generated with polyblep
+    OSCILLATOR_STORAGE_FM,                // sine, phase modulated by another sine
+} oscillator_storage_t;
+
+// the sub-oscillator is a square one or two octaves below the note, mixed with
+// the main waveform.
+typedef enum {
+    OSCILLATOR_SUB_OCTAVE_ONE,
+    OSCILLATOR_SUB_OCTAVE_TWO,
+    OSCILLATOR_SUB_OCTAVE__LAST,
+} oscillator_sub_octave_t;
+
+// the fm waveform is a sine carrier at the note, with its phase modulated by a
+// sine at a ratio of the note, in halves from 1/2 to 8.
+#define oscillator_fm_ratios 16
+
 typedef struct {
     bool _initialized;
     oscillator_phase_t _phase;
@@ -34,9 +105,52 @@ typedef struct {
     oscillator_waveform_t _waveform_next;
     uint8_t _note;
     uint8_t _note_next;
+    int16_t _bend;
+    uint16_t _pitch_mod;
+    bool _portamento;
+    uint16_t _glide_rate;
+    uint32_t _glide;
+    uint16_t _noise;
+    uint8_t _pulse_width;
+    int8_t _pulse_width_mod;
+    uint8_t _sub_level;
+    uint8_t _sub_mask;
+    uint8_t _sub_count;
+    oscillator_phase_t _mod_phase;
+    uint8_t _fm_ratio;
+    uint8_t _fm_index;
+    bool _fm_envelope;
+    uint8_t _fm_level;
+    oscillator_phase_t _sync_phase;
+    int16_t _sync_interval;
+    uint32_t _sync_step;
+    uint32_t _step;
+    uint16_t _dt;
+    uint32_t _dt_inv;
+    const int16_t *_table;
+    const int16_t *_table_next;
+    oscillator_storage_t _storage;
+    oscillator_storage_t _storage_next;
+    uint8_t _blend;
 } oscillator_t;
 
 void oscillator_init(oscillator_t *o);
 bool oscillator_set_waveform(oscillator_t *o, oscillator_waveform_t wf);
 void oscillator_set_note(oscillator_t *o, uint8_t n);
+void oscillator_set_bend(oscillator_t *o, int16_t b);
+bool oscillator_set_portamento(oscillator_t *o, bool enable);
+bool oscillator_set_portamento_time(oscillator_t *o, uint8_t t);
+bool oscillator_set_pulse_width(oscillator_t *o, uint8_t w);
+void oscillator_set_pulse_width_mod(oscillator_t *o, int8_t mod);
+bool oscillator_set_sub_level(oscillator_t *o, uint8_t l);
+bool oscillator_set_sub_octave(oscillator_t *o, oscillator_sub_octave_t so);
+bool oscillator_set_fm_ratio(oscillator_t *o, uint8_t r);
+bool oscillator_set_fm_index(oscillator_t *o, uint8_t i);
+bool oscillator_set_fm_envelope(oscillator_t *o, bool enable);
+void oscillator_set_fm_level(oscillator_t *o, uint8_t level);
+bool oscillator_set_sync_interval(oscillator_t *o, uint8_t interval);
+void oscillator_set_pitch_mod(oscillator_t *o, uint16_t ratio);
+uint16_t oscillator_get_pitch_mod_ratio(int16_t steps);
+int16_t oscillator_get_sine(uint16_t phase);
 int16_t oscillator_get_sample(oscillator_t *o);
+void oscillator_render_block(oscillator_t *o, int16_t *buf, uint8_t n);
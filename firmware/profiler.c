@@ -0,0 +1,128 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <avr/io.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "main-data.h"
+
+#ifdef WITH_PROFILER
+
+
+void
+profiler_init(profiler_t *p)
+{
+    if (p == NULL || p->_initialized)
+        return;
+
+    // the spare TCB timer is used as a free-running cycle counter. timestamps
+    // are 16 bits, that is more than enough for each of the stages.
+    TCB1.CCMP = 0xffff;
+    TCB1.CTRLA = TCB_RUNSTDBY_bm | timer_tcb_clksel | TCB_ENABLE_bm;
+
+    p->_initialized = true;
+    profiler_reset(p);
+}
+
+
+void
+profiler_reset(profiler_t *p)
+{
+    if (p == NULL || !p->_initialized)
+        return;
+
+    p->overruns = 0;
+    for (uint8_t i = 0; i < PROFILER_STAGE__LAST; i++) {
+        p->stages[i].min = 0xffff;
+        p->stages[i].avg = 0;
+        p->stages[i].max = 0;
+        p->stages[i]._sum = 0;
+        p->stages[i]._count = 0;
+    }
+}
+
+
+void
+profiler_start(profiler_t *p)
+{
+    if (p != NULL && p->_initialized)
+        p->_timestamp = TCB1.CNT;
+}
+
+
+void
+profiler_stage(profiler_t *p, profiler_stage_t s)
+{
+    if (p == NULL || !p->_initialized || s >= PROFILER_STAGE__LAST)
+        return;
+
+    uint16_t now = TCB1.CNT;
+    uint16_t cycles = now - p->_timestamp;
+    p->_timestamp = now;
+
+    profiler_stats_t *st = &p->stages[s];
+    if (cycles < st->min)
+        st->min = cycles;
+    if (cycles > st->max)
+        st->max = cycles;
+
+    // average is refreshed every 256 samples
+    st->_sum += cycles;
+    if (++st->_count == 0) {
+        st->avg = st->_sum >> 8;
+        st->_sum = 0;
+    }
+}
+
+
+void
+profiler_underruns(profiler_t *p, uint8_t underruns)
+{
+    if (p == NULL || !p->_initialized)
+        return;
+
+    // underruns is a free-running counter incremented by the audio interrupt,
+    // everytime it had to fire again before the main loop rendered a sample.
+    p->overruns += (uint8_t) (underruns - p->_underruns);
+    p->_underruns = underruns;
+}
+
+
+static inline uint8_t*
+sysex_value(uint8_t *buf, uint16_t v)
+{
+    *buf++ = (v >> 14) & 0x7f;
+    *buf++ = (v >> 7) & 0x7f;
+    *buf++ = v & 0x7f;
+    return buf;
+}
+
+
+uint8_t
+profiler_sysex(profiler_t *p, uint8_t *buf, uint8_t len)
+{
+    if (p == NULL || !p->_initialized || buf == NULL || len < profiler_sysex_len)
+        return 0;
+
+    uint8_t *b = buf;
+    *b++ = 0xf0;
+    *b++ = 0x7d;  // non-commercial
+    for (uint8_t i = 0; i < PROFILER_STAGE__LAST; i++) {
+        b = sysex_value(b, p->stages[i].min);
+        b = sysex_value(b, p->stages[i].avg);
+        b = sysex_value(b, p->stages[i].max);
+    }
+    b = sysex_value(b, p->overruns);
+    *b++ = 0xf7;
+
+    return b - buf;
+}
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// profiler is only built when configured with -DWITH_PROFILER=ON, otherwise
+// the stage markers compile to nothing and don't cost any cycles.
+
+typedef enum {
+    PROFILER_STAGE_MIDI,
+    PROFILER_STAGE_SCREEN,
+    PROFILER_STAGE_SETTINGS,
+    PROFILER_STAGE_WAVETABLE,
+    PROFILER_STAGE_OSCILLATOR,
+    PROFILER_STAGE_ADSR,
+    PROFILER_STAGE_AMPLIFIER,
+    PROFILER_STAGE_FILTER,
+    PROFILER_STAGE_DAC,
+    PROFILER_STAGE__LAST,
+} profiler_stage_t;
+
+typedef struct {
+    uint16_t min;
+    uint16_t avg;
+    uint16_t max;
+    uint32_t _sum;
+    uint8_t _count;
+} profiler_stats_t;
+
+typedef struct {
+    bool _initialized;
+    uint16_t _timestamp;
+    uint8_t _underruns;
+    uint16_t overruns;
+    profiler_stats_t stages[PROFILER_STAGE__LAST];
+} profiler_t;
+
+// F0 7D <stage: min avg max> <overruns> F7, each value as 3 7-bit bytes.
+#define profiler_sysex_len (3 + (PROFILER_STAGE__LAST * 3 + 1) * 3)
+
+#ifdef WITH_PROFILER
+
+void profiler_init(profiler_t *p);
+void profiler_reset(profiler_t *p);
+void profiler_start(profiler_t *p);
+void profiler_stage(profiler_t *p, profiler_stage_t s);
+void profiler_underruns(profiler_t *p, uint8_t underruns);
+uint8_t profiler_sysex(profiler_t *p, uint8_t *buf, uint8_t len);
+
+#else
+
+static inline void profiler_init(profiler_t *p) {(void) p;}
+static inline void profiler_start(profiler_t *p) {(void) p;}
+static inline void profiler_stage(profiler_t *p, profiler_stage_t s) {(void) p; (void) s;}
+static inline void profiler_underruns(profiler_t *p, uint8_t underruns) {(void) p; (void) underruns;}
+
+#endif
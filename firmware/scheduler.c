@@ -0,0 +1,54 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "scheduler.h"
+
+
+bool
+scheduler_init(scheduler_t *s, const scheduler_task_t *tasks, uint8_t tasks_len, profiler_t *p)
+{
+    if (s == NULL || s->_initialized || tasks == NULL)
+        return false;
+
+    s->_tasks = tasks;
+    s->_tasks_len = tasks_len;
+    s->_profiler = p;
+    s->deferred = 0;
+    s->_initialized = true;
+    return true;
+}
+
+
+uint16_t
+scheduler_run(scheduler_t *s, uint16_t budget)
+{
+    if (s == NULL || !s->_initialized)
+        return budget;
+
+    // every task that fits in the remaining budget runs once, in priority
+    // order. tasks that don't fit are deferred to the next call, that will
+    // happen as soon as the main loop has some spare time again.
+    for (uint8_t i = 0; i < s->_tasks_len; i++) {
+        const scheduler_task_t *t = &s->_tasks[i];
+        if (t->cost > budget) {
+            s->deferred++;
+            continue;
+        }
+
+        profiler_start(s->_profiler);
+        t->func();
+        profiler_stage(s->_profiler, t->stage);
+        budget -= t->cost;
+    }
+
+    return budget;
+}
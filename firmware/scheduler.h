@@ -0,0 +1,31 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "profiler.h"
+
+typedef struct {
+    void (*func)(void);
+    uint16_t cost;  // estimated worst case, in cpu cycles
+    profiler_stage_t stage;
+} scheduler_task_t;
+
+typedef struct {
+    bool _initialized;
+    const scheduler_task_t *_tasks;
+    uint8_t _tasks_len;
+    profiler_t *_profiler;
+    uint16_t deferred;  // tasks skipped for lack of budget, for diagnostics
+} scheduler_t;
+
+// tasks are sorted by priority, highest first.
+bool scheduler_init(scheduler_t *s, const scheduler_task_t *tasks, uint8_t tasks_len, profiler_t *p);
+uint16_t scheduler_run(scheduler_t *s, uint16_t budget);
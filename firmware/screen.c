@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <avr/pgmspace.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -14,6 +15,7 @@
 #include "filter.h"
 #include "oled.h"
 #include "oscillator.h"
+#include "profiler.h"
 #include "screen.h"
 #include "screen-data.h"
 
@@ -29,6 +31,19 @@
 // F: LPF | FC: 20.00kHz
 
 
+// when built with the profiler, 2 diagnostics pages can replace the main screen.
+// cycles are shown per call for background tasks and per block for audio:
+
+// STG   MIN   AVG   MAX    STG   MIN   AVG   MAX
+// MID    12    20   305    OSC   150   182   260
+// SCR    14    25    44    ENV   130   151   190
+// SET     4     4     4    AMP   120   120   120
+// WAV     6     8  1900    FLT   245   245   245
+// deferred: 3              DAC   110   110   110
+// ...cycles per call...    .cycles per block...
+// overruns: 0              overruns: 0
+
+
 // a notification screen appears for a few seconds (but the context of
 // the main screen is still kept in sync with data in background):
 
@@ -53,6 +68,7 @@ screen_init(screen_t *s)
 
     s->_initialized = true;
     s->_notification = false;
+    s->_diagnostics = 0;
 
     memcpy(s->_line0, "[db-synth]           ", 22);
     memcpy(s->_line2, "WF:          | CH:   ", 22);
@@ -64,26 +80,66 @@ screen_init(screen_t *s)
 }
 
 
+static void
+main_screen(screen_t *s)
+{
+    // the state of the screen_t pointer is checked by the caller.
+
+    oled_line(&s->oled, 0, s->_line0, OLED_HALIGN_LEFT);
+    oled_line(&s->oled, 1, "", OLED_HALIGN_LEFT);
+    oled_line(&s->oled, 2, s->_line2, OLED_HALIGN_LEFT);
+    oled_line(&s->oled, 3, "", OLED_HALIGN_LEFT);
+    oled_line(&s->oled, 4, s->_line4, OLED_HALIGN_LEFT);
+    oled_line(&s->oled, 5, s->_line5, OLED_HALIGN_LEFT);
+    oled_line(&s->oled, 6, "", OLED_HALIGN_LEFT);
+    oled_line(&s->oled, 7, s->_line7, OLED_HALIGN_LEFT);
+}
+
+
+static bool
+diagnostics_screen(screen_t *s)
+{
+    // the state of the screen_t pointer is checked by the caller.
+
+    // stage values are filled by screen_set_profiler
+    bool rv = true;
+    for (uint8_t i = 0; i < oled_lines; i++)
+        rv = oled_line(&s->oled, i, "", OLED_HALIGN_LEFT) && rv;
+    rv = oled_line(&s->oled, 0, "STG   MIN   AVG   MAX", OLED_HALIGN_LEFT) && rv;
+    return oled_line(&s->oled, 6, s->_diagnostics == 1 ? "cycles per call" : "cycles per block", OLED_HALIGN_CENTER) && rv;
+}
+
+
 bool
 screen_task(screen_t *s)
 {
     if (s == NULL || !s->_initialized)
         return false;
 
-    // TODO: we have a spare TCB timer available, maybe use it for this?
-    if (s->_notification && ++s->_notification_count == sample_rate && ++s->_notification_sec == 2) {
-        oled_line(&s->oled, 0, s->_line0, OLED_HALIGN_LEFT);
-        oled_line(&s->oled, 1, "", OLED_HALIGN_LEFT);
-        oled_line(&s->oled, 2, s->_line2, OLED_HALIGN_LEFT);
-        oled_line(&s->oled, 3, "", OLED_HALIGN_LEFT);
-        oled_line(&s->oled, 4, s->_line4, OLED_HALIGN_LEFT);
-        oled_line(&s->oled, 5, s->_line5, OLED_HALIGN_LEFT);
-        oled_line(&s->oled, 6, "", OLED_HALIGN_LEFT);
-        oled_line(&s->oled, 7, s->_line7, OLED_HALIGN_LEFT);
+    return oled_task(&s->oled);
+}
+
+
+void
+screen_tick(screen_t *s, uint8_t samples)
+{
+    if (s == NULL || !s->_initialized || !s->_notification)
+        return;
+
+    // notifications are timed by rendered audio samples, because the task
+    // runs whenever the main loop has spare time.
+    s->_notification_count += samples;
+    if (s->_notification_count < sample_rate)
+        return;
+
+    s->_notification_count -= sample_rate;
+    if (++s->_notification_sec == 2) {
         s->_notification = false;
+        if (s->_diagnostics == 0)
+            main_screen(s);
+        else
+            diagnostics_screen(s);
     }
-
-    return oled_task(&s->oled);
 }
 
 
@@ -109,6 +165,9 @@ screen_notification(screen_t *s, screen_notification_t n)
     case SCREEN_NOTIFICATION_PRESET_UPDATED:
         m = "PRESET UPDATED";
         break;
+    case SCREEN_NOTIFICATION_WAVETABLE_UPDATED:
+        m = "WAVETABLE SAVED";
+        break;
     default:
         return false;
     }
@@ -133,6 +192,7 @@ screen_set_oscillator_waveform(screen_t *s, oscillator_waveform_t wf)
     if (s == NULL)
         return false;
 
+    char user[] = "User    ";
     char *w;
     switch (wf) {
     case OSCILLATOR_WAVEFORM_SQUARE:
@@ -147,13 +207,27 @@ screen_set_oscillator_waveform(screen_t *s, oscillator_waveform_t wf)
     case OSCILLATOR_WAVEFORM_SAW:
         w = "Saw     ";
         break;
+    case OSCILLATOR_WAVEFORM_NOISE:
+        w = "Noise   ";
+        break;
+    case OSCILLATOR_WAVEFORM_PULSE:
+        w = "Pulse   ";
+        break;
+    case OSCILLATOR_WAVEFORM_FM:
+        w = "FM      ";
+        break;
     default:
-        w = "Unknown ";
+        if (wf < oscillator_waveforms) {
+            user[5] = '1' + wf - OSCILLATOR_WAVEFORM__LAST;
+            w = user;
+        }
+        else
+            w = "Unknown ";
         break;
     }
 
     memcpy(s->_line2 + 4, w, 8);
-    if (s->_notification)
+    if (s->_notification || s->_diagnostics != 0)
         return true;
     return oled_line(&s->oled, 2, s->_line2, OLED_HALIGN_LEFT);
 }
@@ -169,7 +243,7 @@ screen_set_midi_channel(screen_t *s, uint8_t midi_ch)
     s->_line2[19] = midi_ch > 9 ? '1' : midi_ch + '0';
     s->_line2[20] = midi_ch > 9 ? (midi_ch % 10) + '0' : ' ';
 
-    if (s->_notification)
+    if (s->_notification || s->_diagnostics != 0)
         return true;
     return oled_line(&s->oled, 2, s->_line2, OLED_HALIGN_LEFT);
 }
@@ -183,7 +257,7 @@ screen_set_adsr_type(screen_t *s, adsr_type_t t)
 
     s->_line4[1] = s->_line4[13] = s->_line5[13] = t == ADSR_TYPE_LINEAR ? 'L' : 'E';
 
-    if (s->_notification)
+    if (s->_notification || s->_diagnostics != 0)
         return true;
     return oled_line(&s->oled, 4, s->_line4, OLED_HALIGN_LEFT) && oled_line(&s->oled, 5, s->_line5, OLED_HALIGN_LEFT);
 }
@@ -195,9 +269,9 @@ screen_set_adsr_attack(screen_t *s, uint8_t v)
     if (s == NULL || v >= adsr_time_descriptions_rows)
         return false;
 
-    memcpy(s->_line4 + 4, adsr_time_descriptions[v], adsr_time_descriptions_cols);
+    memcpy_P(s->_line4 + 4, adsr_time_descriptions[v], adsr_time_descriptions_cols);
 
-    if (s->_notification)
+    if (s->_notification || s->_diagnostics != 0)
         return true;
     return oled_line(&s->oled, 4, s->_line4, OLED_HALIGN_LEFT);
 }
@@ -209,9 +283,9 @@ screen_set_adsr_decay(screen_t *s, uint8_t v)
     if (s == NULL || v >= adsr_time_descriptions_rows)
         return false;
 
-    memcpy(s->_line4 + 16, adsr_time_descriptions[v], adsr_time_descriptions_cols);
+    memcpy_P(s->_line4 + 16, adsr_time_descriptions[v], adsr_time_descriptions_cols);
 
-    if (s->_notification)
+    if (s->_notification || s->_diagnostics != 0)
         return true;
     return oled_line(&s->oled, 4, s->_line4, OLED_HALIGN_LEFT);
 }
@@ -223,9 +297,9 @@ screen_set_adsr_sustain(screen_t *s, uint8_t v)
     if (s == NULL || v >= adsr_level_descriptions_rows)
         return false;
 
-    memcpy(s->_line5 + 3, adsr_level_descriptions[v], adsr_level_descriptions_cols);
+    memcpy_P(s->_line5 + 3, adsr_level_descriptions[v], adsr_level_descriptions_cols);
 
-    if (s->_notification)
+    if (s->_notification || s->_diagnostics != 0)
         return true;
     return oled_line(&s->oled, 5, s->_line5, OLED_HALIGN_LEFT);
 }
@@ -237,9 +311,9 @@ screen_set_adsr_release(screen_t *s, uint8_t v)
     if (s == NULL || v >= adsr_time_descriptions_rows)
         return false;
 
-    memcpy(s->_line5 + 16, adsr_time_descriptions[v], adsr_time_descriptions_cols);
+    memcpy_P(s->_line5 + 16, adsr_time_descriptions[v], adsr_time_descriptions_cols);
 
-    if (s->_notification)
+    if (s->_notification || s->_diagnostics != 0)
         return true;
     return oled_line(&s->oled, 5, s->_line5, OLED_HALIGN_LEFT);
 }
@@ -266,7 +340,7 @@ screen_set_filter_type(screen_t *s, filter_type_t ft)
         break;
     }
 
-    if (s->_notification)
+    if (s->_notification || s->_diagnostics != 0)
         return true;
     return oled_line(&s->oled, 7, s->_line7, OLED_HALIGN_LEFT);
 }
@@ -278,9 +352,84 @@ screen_set_filter_cutoff(screen_t *s, uint8_t c)
     if (s == NULL || c >= filter_frequency_descriptions_rows)
         return false;
 
-    memcpy(s->_line7 + 13, filter_frequency_descriptions[c], filter_frequency_descriptions_cols);
+    memcpy_P(s->_line7 + 13, filter_frequency_descriptions[c], filter_frequency_descriptions_cols);
 
-    if (s->_notification)
+    if (s->_notification || s->_diagnostics != 0)
         return true;
     return oled_line(&s->oled, 7, s->_line7, OLED_HALIGN_LEFT);
 }
+
+
+bool
+screen_set_diagnostics(screen_t *s, uint8_t page)
+{
+    if (s == NULL || page > 2)
+        return false;
+
+    if (s->_diagnostics == page)
+        return true;
+
+    s->_diagnostics = page;
+    if (s->_notification)
+        return true;
+
+    if (page == 0) {
+        main_screen(s);
+        return true;
+    }
+
+    return diagnostics_screen(s);
+}
+
+
+static void
+format_u16(char *buf, uint16_t v)
+{
+    // right aligned, 5 chars
+    for (int8_t i = 4; i >= 0; i--) {
+        buf[i] = (i == 4 || v != 0) ? (v % 10) + '0' : ' ';
+        v /= 10;
+    }
+}
+
+
+bool
+screen_set_profiler(screen_t *s, const profiler_t *p, uint16_t deferred)
+{
+    if (s == NULL || p == NULL)
+        return false;
+
+    if (s->_notification || s->_diagnostics == 0)
+        return true;
+
+    static const char names[PROFILER_STAGE__LAST][4] = {"MID", "SCR", "SET", "WAV", "OSC", "ENV", "AMP", "FLT", "DAC"};
+
+    uint8_t first = s->_diagnostics == 1 ? PROFILER_STAGE_MIDI : PROFILER_STAGE_OSCILLATOR;
+    uint8_t last = s->_diagnostics == 1 ? PROFILER_STAGE_OSCILLATOR : PROFILER_STAGE__LAST;
+
+    char line[oled_chars_per_line + 1];
+    line[oled_chars_per_line] = 0;
+
+    for (uint8_t i = first; i < last; i++) {
+        memcpy(line, names[i], 3);
+        line[3] = ' ';
+        format_u16(line + 4, p->stages[i].min == 0xffff ? 0 : p->stages[i].min);
+        line[9] = ' ';
+        format_u16(line + 10, p->stages[i].avg);
+        line[15] = ' ';
+        format_u16(line + 16, p->stages[i].max);
+        oled_line(&s->oled, i - first + 1, line, OLED_HALIGN_LEFT);
+    }
+
+    if (s->_diagnostics == 1) {
+        memcpy(line, "deferred: ", 10);
+        format_u16(line + 10, deferred);
+        line[15] = 0;
+        oled_line(&s->oled, 5, line, OLED_HALIGN_LEFT);
+    }
+
+    memcpy(line, "overruns: ", 10);
+    format_u16(line + 10, p->overruns);
+    line[15] = 0;
+    return oled_line(&s->oled, 7, line, OLED_HALIGN_LEFT);
+}
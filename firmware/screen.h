@@ -14,6 +14,7 @@
 #include "filter.h"
 #include "oled.h"
 #include "oscillator.h"
+#include "profiler.h"
 #include "screen-data.h"
 
 typedef struct {
@@ -22,6 +23,7 @@ typedef struct {
     bool _notification;
     uint16_t _notification_count;
     uint8_t _notification_sec;
+    uint8_t _diagnostics;
     char _line0[oled_chars_per_line + 1];
     char _line2[oled_chars_per_line + 1];
     char _line4[oled_chars_per_line + 1];
@@ -32,10 +34,12 @@ typedef struct {
 typedef enum {
     SCREEN_NOTIFICATION_SPLASH,
     SCREEN_NOTIFICATION_PRESET_UPDATED,
+    SCREEN_NOTIFICATION_WAVETABLE_UPDATED,
 } screen_notification_t;
 
 bool screen_init(screen_t *s);
 bool screen_task(screen_t *s);
+void screen_tick(screen_t *s, uint8_t samples);
 bool screen_notification(screen_t *s, screen_notification_t n);
 bool screen_set_oscillator_waveform(screen_t *s, oscillator_waveform_t wf);
 bool screen_set_midi_channel(screen_t *s, uint8_t midi_ch);
@@ -46,3 +50,5 @@ bool screen_set_adsr_sustain(screen_t *s, uint8_t v);
 bool screen_set_adsr_release(screen_t *s, uint8_t v);
 bool screen_set_filter_type(screen_t *s, filter_type_t ft);
 bool screen_set_filter_cutoff(screen_t *s, uint8_t c);
+bool screen_set_diagnostics(screen_t *s, uint8_t page);
+bool screen_set_profiler(screen_t *s, const profiler_t *p, uint16_t deferred);
@@ -7,6 +7,7 @@
  */
 
 #include <avr/eeprom.h>
+#include <avr/io.h>
 #include <avr/pgmspace.h>
 #include <stdbool.h>
 #include <stdint.h>
@@ -50,6 +51,11 @@ settings_task(settings_t *s)
     if (s == NULL || !s->_initialized || !s->_write)
         return false;
 
+    // eeprom_write_byte() busy-waits for the previous write, that takes a
+    // few milliseconds. just try again later instead.
+    if (NVMCTRL.STATUS & NVMCTRL_EEBUSY_bm)
+        return false;
+
 #define _eeprom_addr(member) ((uint8_t*) (((uint8_t*) member) - ((uint8_t*) &s->data)))
 
     // process only the first pending and return
@@ -59,11 +65,66 @@ settings_task(settings_t *s)
         s->pending.midi_channel = false;
         return false;
     }
+    if (s->pending.note_priority) {
+        eeprom_write_byte(_eeprom_addr(&s->data.note_priority), s->data.note_priority);
+        s->pending.note_priority = false;
+        return false;
+    }
+    if (s->pending.legato) {
+        eeprom_write_byte(_eeprom_addr(&s->data.legato), s->data.legato);
+        s->pending.legato = false;
+        return false;
+    }
     if (s->pending.oscillator.waveform) {
         eeprom_write_byte(_eeprom_addr(&s->data.oscillator.waveform), s->data.oscillator.waveform);
         s->pending.oscillator.waveform = false;
         return false;
     }
+    if (s->pending.oscillator.portamento) {
+        eeprom_write_byte(_eeprom_addr(&s->data.oscillator.portamento), s->data.oscillator.portamento);
+        s->pending.oscillator.portamento = false;
+        return false;
+    }
+    if (s->pending.oscillator.portamento_time) {
+        eeprom_write_byte(_eeprom_addr(&s->data.oscillator.portamento_time), s->data.oscillator.portamento_time);
+        s->pending.oscillator.portamento_time = false;
+        return false;
+    }
+    if (s->pending.oscillator.pulse_width) {
+        eeprom_write_byte(_eeprom_addr(&s->data.oscillator.pulse_width), s->data.oscillator.pulse_width);
+        s->pending.oscillator.pulse_width = false;
+        return false;
+    }
+    if (s->pending.oscillator.sub_level) {
+        eeprom_write_byte(_eeprom_addr(&s->data.oscillator.sub_level), s->data.oscillator.sub_level);
+        s->pending.oscillator.sub_level = false;
+        return false;
+    }
+    if (s->pending.oscillator.sub_octave) {
+        eeprom_write_byte(_eeprom_addr(&s->data.oscillator.sub_octave), s->data.oscillator.sub_octave);
+        s->pending.oscillator.sub_octave = false;
+        return false;
+    }
+    if (s->pending.oscillator.fm_ratio) {
+        eeprom_write_byte(_eeprom_addr(&s->data.oscillator.fm_ratio), s->data.oscillator.fm_ratio);
+        s->pending.oscillator.fm_ratio = false;
+        return false;
+    }
+    if (s->pending.oscillator.fm_index) {
+        eeprom_write_byte(_eeprom_addr(&s->data.oscillator.fm_index), s->data.oscillator.fm_index);
+        s->pending.oscillator.fm_index = false;
+        return false;
+    }
+    if (s->pending.oscillator.fm_envelope) {
+        eeprom_write_byte(_eeprom_addr(&s->data.oscillator.fm_envelope), s->data.oscillator.fm_envelope);
+        s->pending.oscillator.fm_envelope = false;
+        return false;
+    }
+    if (s->pending.oscillator.sync_interval) {
+        eeprom_write_byte(_eeprom_addr(&s->data.oscillator.sync_interval), s->data.oscillator.sync_interval);
+        s->pending.oscillator.sync_interval = false;
+        return false;
+    }
     if (s->pending.adsr.type) {
         eeprom_write_byte(_eeprom_addr(&s->data.adsr.type), s->data.adsr.type);
         s->pending.adsr.type = false;
@@ -99,6 +160,26 @@ settings_task(settings_t *s)
         s->pending.filter.cutoff = false;
         return false;
     }
+    if (s->pending.lfo.waveform) {
+        eeprom_write_byte(_eeprom_addr(&s->data.lfo.waveform), s->data.lfo.waveform);
+        s->pending.lfo.waveform = false;
+        return false;
+    }
+    if (s->pending.lfo.rate) {
+        eeprom_write_byte(_eeprom_addr(&s->data.lfo.rate), s->data.lfo.rate);
+        s->pending.lfo.rate = false;
+        return false;
+    }
+    if (s->pending.lfo.depth) {
+        eeprom_write_byte(_eeprom_addr(&s->data.lfo.depth), s->data.lfo.depth);
+        s->pending.lfo.depth = false;
+        return false;
+    }
+    if (s->pending.lfo.destination) {
+        eeprom_write_byte(_eeprom_addr(&s->data.lfo.destination), s->data.lfo.destination);
+        s->pending.lfo.destination = false;
+        return false;
+    }
 
 #undef _eeprom_addr
 
@@ -21,11 +21,27 @@ typedef struct __attribute__((packed)) {
     uint8_t _padding1;
     uint8_t version;
     uint8_t midi_channel;
-    uint8_t _padding2[13];
 
+    // were padding, that older firmware wrote as zeros. only used by the
+    // mono synth.
+    uint8_t note_priority;
+    uint8_t legato;
+    uint8_t _padding2[11];
+
+    // the bytes after the waveform were padding, that older firmware wrote as
+    // zeros.
     struct __attribute__((packed)) {
         uint8_t waveform;
-        uint8_t _padding[15];
+        uint8_t portamento;
+        uint8_t portamento_time;
+        uint8_t pulse_width;
+        uint8_t sub_level;
+        uint8_t sub_octave;
+        uint8_t fm_ratio;
+        uint8_t fm_index;
+        uint8_t fm_envelope;
+        uint8_t sync_interval;
+        uint8_t _padding[6];
     } oscillator;
 
     struct __attribute__((packed)) {
@@ -42,13 +58,34 @@ typedef struct __attribute__((packed)) {
         uint8_t cutoff;
         uint8_t _padding[14];
     } filter;
+
+    // settings written by older firmware don't have these, and the erased
+    // eeprom bytes are rejected by the synth, that keeps its defaults.
+    struct __attribute__((packed)) {
+        uint8_t waveform;
+        uint8_t rate;
+        uint8_t depth;
+        uint8_t destination;
+        uint8_t _padding[12];
+    } lfo;
 } settings_data_t;
 
 typedef struct {
     bool midi_channel;
+    bool note_priority;
+    bool legato;
 
     struct {
         bool waveform;
+        bool portamento;
+        bool portamento_time;
+        bool pulse_width;
+        bool sub_level;
+        bool sub_octave;
+        bool fm_ratio;
+        bool fm_index;
+        bool fm_envelope;
+        bool sync_interval;
     } oscillator;
 
     struct {
@@ -63,6 +100,13 @@ typedef struct {
         bool type;
         bool cutoff;
     } filter;
+
+    struct {
+        bool waveform;
+        bool rate;
+        bool depth;
+        bool destination;
+    } lfo;
 } settings_pending_t;
 
 typedef struct {
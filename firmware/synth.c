@@ -0,0 +1,636 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "adsr.h"
+#include "amplifier.h"
+#include "filter.h"
+#include "lfo.h"
+#include "midi.h"
+#include "oscillator.h"
+#include "profiler.h"
+#include "synth.h"
+#include "main-data.h"
+
+#if SYNTH_VOICES < 1 || SYNTH_VOICES > 6
+#error "SYNTH_VOICES must be between 1 and 6"
+#endif
+
+#if SYNTH_VOICES > 1
+// 1/sqrt(voices) as 8.8 fixed point, so that a chord of uncorrelated notes
+// has about the same loudness as a single note.
+static const uint16_t voice_gains[] = {0x100, 0xb5, 0x94, 0x80, 0x72, 0x69};
+#endif
+
+
+void
+synth_init(synth_t *s, synth_param_cb_t cb, profiler_t *p)
+{
+    if (s == NULL || s->_initialized)
+        return;
+
+    for (uint8_t i = 0; i < SYNTH_VOICES; i++) {
+        synth_voice_t *v = &s->_voices[i];
+        adsr_init(&v->adsr);
+        oscillator_init(&v->oscillator);
+        v->note = 0;
+        v->velocity = 0;
+        v->age = 0;
+    }
+    filter_init(&s->_filter);
+    lfo_init(&s->_lfo);
+
+    s->_age = 0;
+    s->_bend = 0;
+    s->_bend_range = 2;
+    s->_rpn[0] = 0x7f;
+    s->_rpn[1] = 0x7f;
+#if SYNTH_VOICES == 1
+    s->_note_priority = SYNTH_NOTE_PRIORITY_LAST;
+    s->_legato = false;
+    s->_notes_len = 0;
+#endif
+    s->_param_cb = cb;
+    s->_profiler = p;
+    s->_initialized = true;
+}
+
+
+bool
+synth_set_param(synth_t *s, synth_param_t p, uint8_t v)
+{
+    if (s == NULL || !s->_initialized)
+        return false;
+
+    // every voice has the same sound parameters, the first voice is used to
+    // detect changes.
+    bool rv = false;
+
+    for (uint8_t i = 0; i < SYNTH_VOICES; i++) {
+        synth_voice_t *vc = &s->_voices[i];
+        bool changed;
+
+        switch (p) {
+        case SYNTH_PARAM_OSCILLATOR_WAVEFORM:
+            changed = oscillator_set_waveform(&vc->oscillator, v);
+            break;
+
+        case SYNTH_PARAM_PORTAMENTO:
+            if (v > 1)
+                return false;
+            changed = oscillator_set_portamento(&vc->oscillator, v);
+            break;
+
+        case SYNTH_PARAM_PORTAMENTO_TIME:
+            changed = oscillator_set_portamento_time(&vc->oscillator, v);
+            break;
+
+        case SYNTH_PARAM_PULSE_WIDTH:
+            changed = oscillator_set_pulse_width(&vc->oscillator, v);
+            break;
+
+        case SYNTH_PARAM_SUB_LEVEL:
+            changed = oscillator_set_sub_level(&vc->oscillator, v);
+            break;
+
+        case SYNTH_PARAM_SUB_OCTAVE:
+            changed = oscillator_set_sub_octave(&vc->oscillator, v);
+            break;
+
+        case SYNTH_PARAM_FM_RATIO:
+            changed = oscillator_set_fm_ratio(&vc->oscillator, v);
+            break;
+
+        case SYNTH_PARAM_FM_INDEX:
+            changed = oscillator_set_fm_index(&vc->oscillator, v);
+            break;
+
+        case SYNTH_PARAM_FM_ENVELOPE:
+            if (v > 1)
+                return false;
+            changed = oscillator_set_fm_envelope(&vc->oscillator, v);
+            break;
+
+        case SYNTH_PARAM_SYNC_INTERVAL:
+            changed = oscillator_set_sync_interval(&vc->oscillator, v);
+            break;
+
+        case SYNTH_PARAM_ADSR_TYPE:
+            changed = adsr_set_type(&vc->adsr, v);
+            break;
+
+        case SYNTH_PARAM_ADSR_ATTACK:
+            changed = adsr_set_attack(&vc->adsr, v);
+            break;
+
+        case SYNTH_PARAM_ADSR_DECAY:
+            changed = adsr_set_decay(&vc->adsr, v);
+            break;
+
+        case SYNTH_PARAM_ADSR_SUSTAIN:
+            changed = adsr_set_sustain(&vc->adsr, v);
+            break;
+
+        case SYNTH_PARAM_ADSR_RELEASE:
+            changed = adsr_set_release(&vc->adsr, v);
+            break;
+
+        case SYNTH_PARAM_FILTER_TYPE:
+            return filter_set_type(&s->_filter, v);
+
+        case SYNTH_PARAM_FILTER_CUTOFF:
+            return filter_set_cutoff(&s->_filter, v);
+
+        case SYNTH_PARAM_LFO_WAVEFORM:
+            return lfo_set_waveform(&s->_lfo, v);
+
+        case SYNTH_PARAM_LFO_RATE:
+            return lfo_set_rate(&s->_lfo, v);
+
+        case SYNTH_PARAM_LFO_DEPTH:
+            return lfo_set_depth(&s->_lfo, v);
+
+        case SYNTH_PARAM_LFO_DESTINATION:
+            return lfo_set_destination(&s->_lfo, v);
+
+#if SYNTH_VOICES == 1
+        case SYNTH_PARAM_NOTE_PRIORITY:
+            if (v >= SYNTH_NOTE_PRIORITY__LAST || s->_note_priority == v)
+                return false;
+            s->_note_priority = v;
+            return true;
+
+        case SYNTH_PARAM_LEGATO:
+            if (v > 1 || s->_legato == v)
+                return false;
+            s->_legato = v;
+            return true;
+#endif
+
+        default:
+            return false;
+        }
+
+        if (i == 0)
+            rv = changed;
+    }
+
+    return rv;
+}
+
+
+static inline void
+set_param_from_cc(synth_t *s, synth_param_t p, uint8_t v)
+{
+    // the state of the synth_t pointer is checked by the caller.
+
+    bool changed = synth_set_param(s, p, v);
+    if (s->_param_cb != NULL)
+        s->_param_cb(p, v, changed);
+}
+
+
+static inline uint8_t
+cc_to_enum(uint8_t v, uint8_t last)
+{
+    uint8_t rv = v / (0x80 / last);
+    if (rv >= last)
+        rv--;
+    return rv;
+}
+
+
+static void
+set_bend(synth_t *s)
+{
+    // the state of the synth_t pointer is checked by the caller.
+
+    // 14 bits bend value scaled to the range, rounded to oscillator bend
+    // steps. the phase steps are only recomputed here, not for every sample.
+    int16_t b = (((int32_t) s->_bend * s->_bend_range * oscillator_bend_steps) + 0x1000) >> 13;
+    for (uint8_t i = 0; i < SYNTH_VOICES; i++)
+        oscillator_set_bend(&s->_voices[i].oscillator, b);
+}
+
+
+#if SYNTH_VOICES == 1
+
+static void
+note_stack_remove(synth_t *s, uint8_t note)
+{
+    // the state of the synth_t pointer is checked by the caller.
+
+    uint8_t j = 0;
+    for (uint8_t i = 0; i < s->_notes_len; i++) {
+        if (s->_notes[i] == note)
+            continue;
+        s->_notes[j] = s->_notes[i];
+        s->_velocities[j++] = s->_velocities[i];
+    }
+    s->_notes_len = j;
+}
+
+
+static void
+note_stack_push(synth_t *s, uint8_t note, uint8_t velocity)
+{
+    // the state of the synth_t pointer is checked by the caller.
+
+    note_stack_remove(s, note);
+    if (s->_notes_len == synth_note_stack_len) {
+        memmove(s->_notes, s->_notes + 1, synth_note_stack_len - 1);
+        memmove(s->_velocities, s->_velocities + 1, synth_note_stack_len - 1);
+        s->_notes_len--;
+    }
+    s->_notes[s->_notes_len] = note;
+    s->_velocities[s->_notes_len++] = velocity;
+}
+
+
+static uint8_t
+note_stack_select(synth_t *s)
+{
+    // the state of the synth_t pointer is checked by the caller, and the
+    // stack must not be empty.
+
+    uint8_t rv = s->_notes_len - 1;
+    if (s->_note_priority == SYNTH_NOTE_PRIORITY_LAST)
+        return rv;
+
+    for (uint8_t i = 0; i < s->_notes_len; i++) {
+        if (s->_note_priority == SYNTH_NOTE_PRIORITY_LOW ? s->_notes[i] < s->_notes[rv] : s->_notes[i] > s->_notes[rv])
+            rv = i;
+    }
+    return rv;
+}
+
+
+static void
+play_note_stack(synth_t *s)
+{
+    // the state of the synth_t pointer is checked by the caller.
+
+    synth_voice_t *v = &s->_voices[0];
+    adsr_state_t st = adsr_get_state(&v->adsr);
+    bool gated = st != ADSR_STATE_OFF && st != ADSR_STATE_RELEASE;
+
+    if (s->_notes_len == 0) {
+        if (gated)
+            adsr_unset_gate(&v->adsr, false);
+        return;
+    }
+
+    uint8_t i = note_stack_select(s);
+    if (gated && v->note == s->_notes[i])
+        return;
+
+    oscillator_set_note(&v->oscillator, s->_notes[i]);
+    v->note = s->_notes[i];
+
+    // legato notes keep the envelope and the velocity of the first note.
+    if (gated && s->_legato)
+        return;
+
+    v->velocity = s->_velocities[i] * 2;
+    adsr_set_gate(&v->adsr);
+}
+
+#else
+
+static synth_voice_t*
+allocate_voice(synth_t *s, uint8_t note)
+{
+    // the state of the synth_t pointer is checked by the caller.
+
+    // retrigger the voice already playing the note, or use a free voice.
+    synth_voice_t *free_voice = NULL;
+    for (uint8_t i = 0; i < SYNTH_VOICES; i++) {
+        synth_voice_t *v = &s->_voices[i];
+        adsr_state_t st = adsr_get_state(&v->adsr);
+        if (st != ADSR_STATE_OFF && v->note == note)
+            return v;
+        if (st == ADSR_STATE_OFF && free_voice == NULL)
+            free_voice = v;
+    }
+    if (free_voice != NULL)
+        return free_voice;
+
+    // steal the quietest released voice, or the oldest one if every voice is
+    // still gated.
+    synth_voice_t *rv = NULL;
+    for (uint8_t i = 0; i < SYNTH_VOICES; i++) {
+        synth_voice_t *v = &s->_voices[i];
+        if (adsr_get_state(&v->adsr) != ADSR_STATE_RELEASE)
+            continue;
+        if (rv == NULL || adsr_get_level(&v->adsr) < adsr_get_level(&rv->adsr))
+            rv = v;
+    }
+    if (rv != NULL)
+        return rv;
+
+    rv = &s->_voices[0];
+    for (uint8_t i = 1; i < SYNTH_VOICES; i++) {
+        synth_voice_t *v = &s->_voices[i];
+        if ((uint16_t) (s->_age - v->age) > (uint16_t) (s->_age - rv->age))
+            rv = v;
+    }
+    return rv;
+}
+
+
+#endif
+
+
+void
+synth_midi_channel(synth_t *s, midi_command_t cmd, uint8_t *buf, uint8_t len)
+{
+    if (s == NULL || !s->_initialized || buf == NULL)
+        return;
+
+    switch (cmd) {
+    case MIDI_NOTE_ON:
+#if SYNTH_VOICES == 1
+        if (len == 2 && buf[1] != 0) {
+            note_stack_push(s, buf[0], buf[1]);
+            play_note_stack(s);
+            break;
+        }
+
+    // fall through
+    case MIDI_NOTE_OFF:
+        note_stack_remove(s, buf[0]);
+        play_note_stack(s);
+        break;
+#else
+        if (len == 2 && buf[1] != 0) {
+            synth_voice_t *v = allocate_voice(s, buf[0]);
+            oscillator_set_note(&v->oscillator, buf[0]);
+            v->note = buf[0];
+            v->velocity = ((uint16_t) buf[1] * 2 * voice_gains[SYNTH_VOICES - 1]) >> 8;
+            v->age = ++s->_age;
+            adsr_set_gate(&v->adsr);
+            break;
+        }
+
+    // fall through
+    case MIDI_NOTE_OFF:
+        for (uint8_t i = 0; i < SYNTH_VOICES; i++) {
+            synth_voice_t *v = &s->_voices[i];
+            adsr_state_t st = adsr_get_state(&v->adsr);
+            if (buf[0] == v->note && st != ADSR_STATE_OFF && st != ADSR_STATE_RELEASE)
+                adsr_unset_gate(&v->adsr, false);
+        }
+        break;
+#endif
+
+    case MIDI_CONTROL_CHANGE:
+        if (len != 2)
+            break;
+
+        switch (buf[0]) {
+        case 3:  // waveform
+            set_param_from_cc(s, SYNTH_PARAM_OSCILLATOR_WAVEFORM, cc_to_enum(buf[1], oscillator_waveforms));
+            break;
+
+        case 5:  // portamento time
+            set_param_from_cc(s, SYNTH_PARAM_PORTAMENTO_TIME, buf[1]);
+            break;
+
+        case 65:  // portamento on/off
+            set_param_from_cc(s, SYNTH_PARAM_PORTAMENTO, buf[1] >= 0x40);
+            break;
+
+        case 70:  // adsr type
+            set_param_from_cc(s, SYNTH_PARAM_ADSR_TYPE, cc_to_enum(buf[1], ADSR_TYPE__LAST));
+            break;
+
+        case 71:  // filter type
+            set_param_from_cc(s, SYNTH_PARAM_FILTER_TYPE, cc_to_enum(buf[1], FILTER_TYPE__LAST));
+            break;
+
+        case 72:  // adsr release
+            set_param_from_cc(s, SYNTH_PARAM_ADSR_RELEASE, buf[1]);
+            break;
+
+        case 73:  // adsr attack
+            set_param_from_cc(s, SYNTH_PARAM_ADSR_ATTACK, buf[1]);
+            break;
+
+        case 74:  // filter cutoff
+            set_param_from_cc(s, SYNTH_PARAM_FILTER_CUTOFF, buf[1]);
+            break;
+
+        case 75:  // adsr decay
+            set_param_from_cc(s, SYNTH_PARAM_ADSR_DECAY, buf[1]);
+            break;
+
+        case 76:  // lfo rate
+            set_param_from_cc(s, SYNTH_PARAM_LFO_RATE, buf[1]);
+            break;
+
+        case 77:  // lfo depth
+            set_param_from_cc(s, SYNTH_PARAM_LFO_DEPTH, buf[1]);
+            break;
+
+        case 78:  // lfo waveform
+            set_param_from_cc(s, SYNTH_PARAM_LFO_WAVEFORM, cc_to_enum(buf[1], LFO_WAVEFORM__LAST));
+            break;
+
+        case 79:  // adsr sustain
+            set_param_from_cc(s, SYNTH_PARAM_ADSR_SUSTAIN, buf[1]);
+            break;
+
+        case 85:  // lfo destination
+            set_param_from_cc(s, SYNTH_PARAM_LFO_DESTINATION, cc_to_enum(buf[1], LFO_DESTINATION__LAST));
+            break;
+
+        case 86:  // sub-oscillator level
+            set_param_from_cc(s, SYNTH_PARAM_SUB_LEVEL, buf[1]);
+            break;
+
+        case 87:  // sub-oscillator octave
+            set_param_from_cc(s, SYNTH_PARAM_SUB_OCTAVE, cc_to_enum(buf[1], OSCILLATOR_SUB_OCTAVE__LAST));
+            break;
+
+        case 88:  // pulse width
+            set_param_from_cc(s, SYNTH_PARAM_PULSE_WIDTH, buf[1]);
+            break;
+
+        case 89:  // fm ratio
+            set_param_from_cc(s, SYNTH_PARAM_FM_RATIO, cc_to_enum(buf[1], oscillator_fm_ratios));
+            break;
+
+        case 90:  // fm index
+            set_param_from_cc(s, SYNTH_PARAM_FM_INDEX, buf[1]);
+            break;
+
+        case 94:  // hard sync interval
+            set_param_from_cc(s, SYNTH_PARAM_SYNC_INTERVAL, buf[1]);
+            break;
+
+        case 9:  // fm index from the envelope
+            set_param_from_cc(s, SYNTH_PARAM_FM_ENVELOPE, buf[1] >= 0x40);
+            break;
+
+#if SYNTH_VOICES == 1
+        // the polyphonic synth has no note stack, these are not handled, and
+        // not stored in the settings.
+        case 14:  // note priority
+            set_param_from_cc(s, SYNTH_PARAM_NOTE_PRIORITY, cc_to_enum(buf[1], SYNTH_NOTE_PRIORITY__LAST));
+            break;
+
+        case 68:  // legato on/off
+            set_param_from_cc(s, SYNTH_PARAM_LEGATO, buf[1] >= 0x40);
+            break;
+#endif
+
+        case 6:  // data entry msb
+            if (s->_rpn[0] == 0 && s->_rpn[1] == 0) {  // pitch bend sensitivity
+                s->_bend_range = buf[1] > 24 ? 24 : buf[1];
+                set_bend(s);
+            }
+            break;
+
+        case 100:  // rpn lsb
+            s->_rpn[1] = buf[1];
+            break;
+
+        case 101:  // rpn msb
+            s->_rpn[0] = buf[1];
+            break;
+
+        case 121:  // reset all controllers
+            s->_rpn[0] = 0x7f;
+            s->_rpn[1] = 0x7f;
+            s->_bend = 0;
+            set_bend(s);
+            break;
+
+        case 120:  // all sound off
+        case 123:  // all notes off
+#if SYNTH_VOICES == 1
+            s->_notes_len = 0;
+#endif
+            for (uint8_t i = 0; i < SYNTH_VOICES; i++)
+                adsr_unset_gate(&s->_voices[i].adsr, true);
+            break;
+        }
+        break;
+
+    case MIDI_PITCH_BEND:
+        if (len == 2) {
+            s->_bend = (int16_t) ((buf[1] << 7) | buf[0]) - 0x2000;
+            set_bend(s);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+
+bool
+synth_is_idle(synth_t *s)
+{
+    if (s == NULL || !s->_initialized)
+        return true;
+
+    for (uint8_t i = 0; i < SYNTH_VOICES; i++)
+        if (adsr_get_state(&s->_voices[i].adsr) != ADSR_STATE_OFF)
+            return false;
+    return true;
+}
+
+
+void
+synth_render_block(synth_t *s, uint16_t *buf, uint8_t n)
+{
+    if (s == NULL || !s->_initialized || n > synth_block_len) {
+        // silence is the middle of the dac range
+        for (uint8_t i = 0; i < n; i++)
+            buf[i] = output_offset;
+        return;
+    }
+
+    int16_t block[synth_block_len];
+
+    // the lfo runs once per block. pitch is modulated up to 2 semitones,
+    // cutoff and pulse width up to 63 steps, and amplitude down to silence,
+    // at full depth.
+    int16_t mod = lfo_render(&s->_lfo, n);
+    lfo_destination_t dest = lfo_get_destination(&s->_lfo);
+    uint16_t pitch_mod = dest == LFO_DESTINATION_PITCH ? oscillator_get_pitch_mod_ratio(mod >> 2) : oscillator_pitch_mod_unity;
+    filter_set_cutoff_mod(&s->_filter, dest == LFO_DESTINATION_FILTER ? mod >> 3 : 0);
+    int8_t pulse_width_mod = dest == LFO_DESTINATION_PULSE_WIDTH ? mod >> 3 : 0;
+    uint8_t gain = dest == LFO_DESTINATION_AMPLITUDE ? 0xff - ((lfo_get_depth(&s->_lfo) * 4 - mod) >> 2) : 0xff;
+
+#if SYNTH_VOICES == 1
+    synth_voice_t *v = &s->_voices[0];
+    uint16_t levels[synth_block_len];
+
+    oscillator_set_pitch_mod(&v->oscillator, pitch_mod);
+    oscillator_set_pulse_width_mod(&v->oscillator, pulse_width_mod);
+    oscillator_set_fm_level(&v->oscillator, adsr_get_level(&v->adsr) >> 8);
+    oscillator_render_block(&v->oscillator, block, n);
+    profiler_stage(s->_profiler, PROFILER_STAGE_OSCILLATOR);
+    adsr_render_block(&v->adsr, levels, n);
+    profiler_stage(s->_profiler, PROFILER_STAGE_ADSR);
+    amplifier_render_block(block, levels, gain == 0xff ? v->velocity : (v->velocity * gain) >> 8, n);
+    profiler_stage(s->_profiler, PROFILER_STAGE_AMPLIFIER);
+#else
+    memset(block, 0, sizeof(block));
+
+    for (uint8_t i = 0; i < SYNTH_VOICES; i++) {
+        synth_voice_t *v = &s->_voices[i];
+
+        // silent voices cost nothing. the envelope starts from zero when the
+        // voice is used again, so the stopped oscillator phase doesn't click.
+        if (adsr_get_state(&v->adsr) == ADSR_STATE_OFF)
+            continue;
+
+        int16_t voice[synth_block_len];
+        uint16_t levels[synth_block_len];
+
+        oscillator_set_pitch_mod(&v->oscillator, pitch_mod);
+        oscillator_set_pulse_width_mod(&v->oscillator, pulse_width_mod);
+        oscillator_set_fm_level(&v->oscillator, adsr_get_level(&v->adsr) >> 8);
+        oscillator_render_block(&v->oscillator, voice, n);
+        profiler_stage(s->_profiler, PROFILER_STAGE_OSCILLATOR);
+        adsr_render_block(&v->adsr, levels, n);
+        profiler_stage(s->_profiler, PROFILER_STAGE_ADSR);
+        amplifier_render_block(voice, levels, gain == 0xff ? v->velocity : (v->velocity * gain) >> 8, n);
+        for (uint8_t j = 0; j < n; j++)
+            block[j] += voice[j];
+        profiler_stage(s->_profiler, PROFILER_STAGE_AMPLIFIER);
+    }
+
+    // the filter expects samples in the oscillator range
+    for (uint8_t i = 0; i < n; i++) {
+        if (block[i] > output_offset)
+            block[i] = output_offset;
+        else if (block[i] < -output_offset)
+            block[i] = -output_offset;
+    }
+#endif
+
+    filter_render_block(&s->_filter, block, n);
+    profiler_stage(s->_profiler, PROFILER_STAGE_FILTER);
+
+    for (uint8_t i = 0; i < n; i++) {
+        int16_t dac_val = block[i] + output_offset;
+        if (dac_val < 0)
+            dac_val = 0;
+        else if (dac_val > (output_offset << 1))
+            dac_val = output_offset << 1;
+        buf[i] = dac_val;
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "adsr.h"
+#include "filter.h"
+#include "lfo.h"
+#include "midi.h"
+#include "oscillator.h"
+#include "profiler.h"
+
+// samples are rendered in blocks. must be a power of 2.
+#define synth_block_len 8
+
+// each voice costs an oscillator, an envelope and an amplifier per sample.
+#ifndef SYNTH_VOICES
+#define SYNTH_VOICES 1
+#endif
+
+// the mono synth remembers the held notes, to fall back to them when the
+// playing note is released. the oldest note is dropped when it is full, so
+// every note event costs a bounded number of steps.
+#define synth_note_stack_len 8
+
+typedef enum {
+    SYNTH_NOTE_PRIORITY_LAST,
+    SYNTH_NOTE_PRIORITY_LOW,
+    SYNTH_NOTE_PRIORITY_HIGH,
+    SYNTH_NOTE_PRIORITY__LAST,
+} synth_note_priority_t;
+
+typedef enum {
+    SYNTH_PARAM_OSCILLATOR_WAVEFORM,
+    SYNTH_PARAM_ADSR_TYPE,
+    SYNTH_PARAM_ADSR_ATTACK,
+    SYNTH_PARAM_ADSR_DECAY,
+    SYNTH_PARAM_ADSR_SUSTAIN,
+    SYNTH_PARAM_ADSR_RELEASE,
+    SYNTH_PARAM_FILTER_TYPE,
+    SYNTH_PARAM_FILTER_CUTOFF,
+    SYNTH_PARAM_LFO_WAVEFORM,
+    SYNTH_PARAM_LFO_RATE,
+    SYNTH_PARAM_LFO_DEPTH,
+    SYNTH_PARAM_LFO_DESTINATION,
+    SYNTH_PARAM_PORTAMENTO,
+    SYNTH_PARAM_PORTAMENTO_TIME,
+    SYNTH_PARAM_PULSE_WIDTH,
+    SYNTH_PARAM_SUB_LEVEL,
+    SYNTH_PARAM_SUB_OCTAVE,
+    SYNTH_PARAM_FM_RATIO,
+    SYNTH_PARAM_FM_INDEX,
+    SYNTH_PARAM_FM_ENVELOPE,
+    SYNTH_PARAM_SYNC_INTERVAL,
+    SYNTH_PARAM_NOTE_PRIORITY,
+    SYNTH_PARAM_LEGATO,
+    SYNTH_PARAM__LAST,
+} synth_param_t;
+
+// called for every parameter set by a midi message, with the value already
+// converted to the parameter range.
+typedef void (*synth_param_cb_t)(synth_param_t p, uint8_t v, bool changed);
+
+typedef struct {
+    adsr_t adsr;
+    oscillator_t oscillator;
+    uint8_t note;
+    uint8_t velocity;
+    uint16_t age;
+} synth_voice_t;
+
+typedef struct {
+    bool _initialized;
+    synth_voice_t _voices[SYNTH_VOICES];
+    filter_t _filter;
+    lfo_t _lfo;
+    uint16_t _age;
+    int16_t _bend;
+    uint8_t _bend_range;
+    uint8_t _rpn[2];
+#if SYNTH_VOICES == 1
+    synth_note_priority_t _note_priority;
+    bool _legato;
+    uint8_t _notes[synth_note_stack_len];
+    uint8_t _velocities[synth_note_stack_len];
+    uint8_t _notes_len;
+#endif
+    synth_param_cb_t _param_cb;
+    profiler_t *_profiler;
+} synth_t;
+
+void synth_init(synth_t *s, synth_param_cb_t cb, profiler_t *p);
+bool synth_set_param(synth_t *s, synth_param_t p, uint8_t v);
+void synth_midi_channel(synth_t *s, midi_command_t cmd, uint8_t *buf, uint8_t len);
+bool synth_is_idle(synth_t *s);
+void synth_render_block(synth_t *s, uint16_t *buf, uint8_t n);
@@ -0,0 +1,186 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <avr/io.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "midi.h"
+#include "wavetable.h"
+
+// built only with user wavetable slots.
+#if OSCILLATOR_USER_WAVETABLES
+
+static_assert(wavetable_samples == PROGMEM_PAGE_SIZE, "each wavetable level must fill a flash page");
+static_assert(wavetable_flash_size <= MAPPED_PROGMEM_SIZE, "user wavetables must fit in the mapped flash window");
+
+// reserves the flash area, so that the firmware fails to link if it grows into
+// it. the build sets the address of the section, and leaves it out of the hex.
+static const uint8_t reserved[wavetable_flash_size] __attribute__((section(".wavetables"), used));
+
+// bytes written per task call. the cpu halts while the flash is written, and
+// the usart only buffers a couple of bytes.
+#define write_chunk 32
+
+
+void
+wavetable_init(wavetable_t *w)
+{
+    if (w == NULL || w->_initialized)
+        return;
+
+#if !(defined(__AVR_HAVE_FLMAP__) && !__AVR_RODATA_IN_RAM__)
+    // builds with read-only data in flash lock the mapping to the last section
+    // at startup, that is where the user wavetables are.
+    NVMCTRL.CTRLB = (NVMCTRL.CTRLB & ~NVMCTRL_FLMAP_gm) | ((wavetable_flash_start / MAPPED_PROGMEM_SIZE) << NVMCTRL_FLMAP_gp);
+#endif
+
+    w->_pos = 0;
+    w->_slot = 0;
+    w->_level = 0;
+    w->_checksum = 0;
+    w->_status = WAVETABLE_STATUS_INVALID;
+    w->_state = WAVETABLE_STATE_IDLE;
+    w->_initialized = true;
+}
+
+
+static bool
+handle_data(wavetable_t *w, uint8_t b)
+{
+    // the state of the wavetable_t pointer is checked by the caller.
+
+    uint16_t pos = w->_pos++;
+
+    if (pos == 0)
+        return b == 0x7d;  // non-commercial
+    if (pos == 1)
+        return b == wavetable_sysex_id;
+
+    if (pos == 2)
+        w->_slot = b;
+    else if (pos == 3)
+        w->_level = b;
+    else if (pos < 4 + wavetable_samples * 2) {
+        uint16_t i = (pos - 4) >> 1;
+        if (pos & 1)
+            w->_page[i] |= b & 0xf;
+        else
+            w->_page[i] = b << 4;
+    }
+    else {
+        // checksum, or too much data
+        w->_status = pos == 4 + wavetable_samples * 2 && b == (w->_checksum & 0x7f) ? WAVETABLE_STATUS_OK : WAVETABLE_STATUS_INVALID;
+        return true;
+    }
+
+    w->_checksum += b;
+    return true;
+}
+
+
+void
+wavetable_sysex(wavetable_t *w, midi_system_subcommand_t cmd, uint8_t *buf, uint8_t len)
+{
+    if (w == NULL || !w->_initialized)
+        return;
+
+    // the sender must wait for the reply before sending the next page.
+    if (w->_state != WAVETABLE_STATE_IDLE && w->_state != WAVETABLE_STATE_RECEIVING)
+        return;
+
+    switch (cmd) {
+    case MIDI_SYSTEM_SYSEX1:
+        if (len == 0) {
+            w->_pos = 0;
+            w->_checksum = 0;
+            w->_status = WAVETABLE_STATUS_INVALID;
+            w->_state = WAVETABLE_STATE_RECEIVING;
+            break;
+        }
+        if (w->_state == WAVETABLE_STATE_RECEIVING && buf != NULL && !handle_data(w, buf[0]))
+            w->_state = WAVETABLE_STATE_IDLE;  // not for us
+        break;
+
+    case MIDI_SYSTEM_SYSEX2:
+        if (w->_state != WAVETABLE_STATE_RECEIVING)
+            break;
+        if (w->_pos < 2) {
+            w->_state = WAVETABLE_STATE_IDLE;
+            break;
+        }
+        if (w->_pos != wavetable_sysex_len - 2 || w->_slot >= OSCILLATOR_USER_WAVETABLES || w->_level >= wavetable_levels)
+            w->_status = WAVETABLE_STATUS_INVALID;
+        w->_state = w->_status == WAVETABLE_STATUS_OK ? WAVETABLE_STATE_ERASE : WAVETABLE_STATE_REPLY;
+        break;
+
+    default:
+        break;
+    }
+}
+
+
+uint8_t
+wavetable_task(wavetable_t *w, bool idle, uint8_t *buf, uint8_t len)
+{
+    if (w == NULL || !w->_initialized || buf == NULL || len < wavetable_reply_len)
+        return 0;
+
+    // the cpu halts while the flash is erased or written, and the audio
+    // stops, so pages are only written while the synth is silent.
+    volatile uint8_t *page = (volatile uint8_t*) wavetable_get(w->_slot, w->_level);
+
+    switch (w->_state) {
+    case WAVETABLE_STATE_ERASE:
+        // the settings may be writing to the eeprom.
+        if (!idle || (NVMCTRL.STATUS & (NVMCTRL_FBUSY_bm | NVMCTRL_EEBUSY_bm)))
+            return 0;
+
+        _PROTECTED_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_FLPER_gc);
+        *page = 0xff;  // any write to the page starts the erase
+        _PROTECTED_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
+
+        w->_pos = 0;
+        w->_state = WAVETABLE_STATE_WRITE;
+        return 0;
+
+    case WAVETABLE_STATE_WRITE:
+        if (!idle || (NVMCTRL.STATUS & (NVMCTRL_FBUSY_bm | NVMCTRL_EEBUSY_bm)))
+            return 0;
+
+        _PROTECTED_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_FLWR_gc);
+        for (uint8_t i = 0; i < write_chunk; i++, w->_pos++)
+            page[w->_pos] = w->_page[w->_pos];
+        _PROTECTED_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_NONE_gc);
+
+        if (w->_pos < wavetable_samples)
+            return 0;
+
+        if (NVMCTRL.STATUS & NVMCTRL_ERROR_gm)
+            w->_status = WAVETABLE_STATUS_FAILED;
+        w->_state = WAVETABLE_STATE_REPLY;
+        return 0;
+
+    case WAVETABLE_STATE_REPLY:
+        buf[0] = 0xf0;
+        buf[1] = 0x7d;  // non-commercial
+        buf[2] = wavetable_sysex_id;
+        buf[3] = w->_slot & 0x7f;
+        buf[4] = w->_level & 0x7f;
+        buf[5] = w->_status;
+        buf[6] = 0xf7;
+        w->_state = WAVETABLE_STATE_IDLE;
+        return wavetable_reply_len;
+
+    default:
+        return 0;
+    }
+}
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+#include <avr/io.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "midi.h"
+#include "oscillator.h"
+
+// user wavetables are uploaded via sysex to a flash area reserved at the end
+// of the flash (the APPDATA section), that is read through the mapped flash
+// window. each slot has one band-limited level per octave, like the builtin
+// wavetables, and each level is a full cycle of 8 bits samples, that fills a
+// flash page.
+
+#define wavetable_levels 10
+#define wavetable_samples 512
+#define wavetable_flash_size ((uint32_t) OSCILLATOR_USER_WAVETABLES * wavetable_levels * wavetable_samples)
+#define wavetable_flash_start (PROGMEM_SIZE - wavetable_flash_size)
+
+// F0 7D 57 <slot> <level> <512 samples as 2 nibbles, high first> <checksum> F7,
+// where checksum is the sum of the bytes from slot to the last nibble, as 7
+// bits. the reply is F0 7D 57 <slot> <level> <status> F7, sent after the page
+// is written.
+#define wavetable_sysex_id 0x57
+#define wavetable_sysex_len (5 + wavetable_samples * 2 + 2)
+#define wavetable_reply_len 7
+
+typedef enum {
+    WAVETABLE_STATUS_OK,
+    WAVETABLE_STATUS_INVALID,
+    WAVETABLE_STATUS_FAILED,
+} wavetable_status_t;
+
+typedef struct {
+    bool _initialized;
+    uint8_t _page[wavetable_samples];
+    uint16_t _pos;
+    uint8_t _slot;
+    uint8_t _level;
+    uint8_t _checksum;
+    wavetable_status_t _status;
+
+    enum {
+        WAVETABLE_STATE_IDLE,
+        WAVETABLE_STATE_RECEIVING,
+        WAVETABLE_STATE_ERASE,
+        WAVETABLE_STATE_WRITE,
+        WAVETABLE_STATE_REPLY,
+    } _state;
+} wavetable_t;
+
+static inline const int8_t*
+wavetable_get(uint8_t slot, uint8_t level)
+{
+    uint32_t addr = wavetable_flash_start + ((uint32_t) slot * wavetable_levels + level) * wavetable_samples;
+    return (const int8_t*) (uintptr_t) (MAPPED_PROGMEM_START + (uint16_t) (addr & (MAPPED_PROGMEM_SIZE - 1)));
+}
+
+void wavetable_init(wavetable_t *w);
+void wavetable_sysex(wavetable_t *w, midi_system_subcommand_t cmd, uint8_t *buf, uint8_t len);
+uint8_t wavetable_task(wavetable_t *w, bool idle, uint8_t *buf, uint8_t len);
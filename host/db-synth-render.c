@@ -0,0 +1,550 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// renders a standard midi file to a wav file using the firmware dsp code, for
+// listening tests and regression checks without hardware.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "settings.h"
+#include "synth.h"
+#include "main-data.h"
+
+// must match the factory settings from main.c
+static const settings_data_t factory_settings = {
+    .version = SETTINGS_VERSION,
+    .midi_channel = 0,
+    .note_priority = SYNTH_NOTE_PRIORITY_LAST,
+    .legato = 0,
+    .oscillator = {
+        .waveform = OSCILLATOR_WAVEFORM_SQUARE,
+        .portamento = 0,
+        .portamento_time = 0x40,
+        .pulse_width = 0x40,
+        .sub_level = 0,
+        .sub_octave = OSCILLATOR_SUB_OCTAVE_ONE,
+        .fm_ratio = 1,
+        .fm_index = 0x20,
+        .fm_envelope = 0,
+        .sync_interval = 0,
+    },
+    .adsr = {
+        .type = ADSR_TYPE_EXPONENTIAL,
+        .attack = 0x08,
+        .decay = 0x08,
+        .sustain = 0x60,
+        .release = 0x08,
+    },
+    .filter = {
+        .type = FILTER_TYPE_LOW_PASS,
+        .cutoff = 0x3f,
+    },
+    .lfo = {
+        .waveform = LFO_WAVEFORM_SINE,
+        .rate = 0x40,
+        .depth = 0,
+        .destination = LFO_DESTINATION_PITCH,
+    },
+};
+
+typedef struct {
+    uint64_t tick;
+    uint32_t order;
+    uint8_t status;
+    uint8_t data[2];
+    uint8_t len;
+    uint32_t tempo;  // meta tempo events only, status 0xff
+} event_t;
+
+typedef struct {
+    event_t *events;
+    size_t len;
+    size_t cap;
+} events_t;
+
+
+static void
+usage(FILE *f)
+{
+    fprintf(f,
+        "usage: db-synth-render [-h] [-s SETTINGS] [-t TAIL] INPUT OUTPUT\n"
+        "\n"
+        "renders a standard midi file (INPUT) to a 16-bit mono wav file (OUTPUT).\n"
+        "\n"
+        "options:\n"
+        "  -h           show this help message and exit\n"
+        "  -s SETTINGS  raw eeprom dump to load settings from\n"
+        "  -t TAIL      milliseconds to render after the last event (default: 1000)\n");
+}
+
+
+static uint8_t*
+read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        return NULL;
+    }
+
+    uint8_t *rv = NULL;
+    size_t cap = 0;
+    *len = 0;
+    while (1) {
+        if (*len == cap) {
+            cap = cap ? cap * 2 : 4096;
+            uint8_t *tmp = realloc(rv, cap);
+            if (tmp == NULL) {
+                free(rv);
+                fclose(f);
+                fprintf(stderr, "error: out of memory\n");
+                return NULL;
+            }
+            rv = tmp;
+        }
+        size_t n = fread(rv + *len, 1, cap - *len, f);
+        if (n == 0)
+            break;
+        *len += n;
+    }
+
+    if (ferror(f)) {
+        perror(path);
+        free(rv);
+        rv = NULL;
+    }
+    fclose(f);
+    return rv;
+}
+
+
+static uint32_t
+read_be(const uint8_t *buf, uint8_t n)
+{
+    uint32_t rv = 0;
+    for (uint8_t i = 0; i < n; i++)
+        rv = (rv << 8) | buf[i];
+    return rv;
+}
+
+
+static bool
+read_varlen(const uint8_t *buf, size_t len, size_t *pos, uint32_t *val)
+{
+    *val = 0;
+    for (uint8_t i = 0; i < 4; i++) {
+        if (*pos >= len)
+            return false;
+        uint8_t b = buf[(*pos)++];
+        *val = (*val << 7) | (b & 0x7f);
+        if (!(b & 0x80))
+            return true;
+    }
+    return false;
+}
+
+
+static bool
+events_append(events_t *e, const event_t *ev)
+{
+    if (e->len == e->cap) {
+        size_t cap = e->cap ? e->cap * 2 : 1024;
+        event_t *tmp = realloc(e->events, cap * sizeof(event_t));
+        if (tmp == NULL)
+            return false;
+        e->events = tmp;
+        e->cap = cap;
+    }
+    e->events[e->len++] = *ev;
+    return true;
+}
+
+
+static int
+events_cmp(const void *a, const void *b)
+{
+    const event_t *ea = a;
+    const event_t *eb = b;
+    if (ea->tick != eb->tick)
+        return ea->tick < eb->tick ? -1 : 1;
+    if (ea->order != eb->order)
+        return ea->order < eb->order ? -1 : 1;
+    return 0;
+}
+
+
+static bool
+parse_track(const uint8_t *buf, size_t len, events_t *e, uint32_t *order)
+{
+    size_t pos = 0;
+    uint64_t tick = 0;
+    uint8_t running = 0;
+
+    while (pos < len) {
+        uint32_t delta;
+        if (!read_varlen(buf, len, &pos, &delta))
+            return false;
+        tick += delta;
+
+        if (pos >= len)
+            return false;
+
+        uint8_t status = buf[pos];
+        if (status & 0x80)
+            pos++;
+        else if (running != 0)
+            status = running;
+        else
+            return false;
+
+        event_t ev = {
+            .tick = tick,
+            .order = (*order)++,
+            .status = status,
+        };
+
+        if (status == 0xff) {
+            running = 0;
+            if (pos >= len)
+                return false;
+            uint8_t type = buf[pos++];
+            uint32_t l;
+            if (!read_varlen(buf, len, &pos, &l) || pos + l > len)
+                return false;
+            if (type == 0x2f)  // end of track
+                return true;
+            if (type == 0x51 && l == 3) {  // tempo
+                ev.tempo = read_be(buf + pos, 3);
+                if (!events_append(e, &ev))
+                    return false;
+            }
+            pos += l;
+            continue;
+        }
+
+        if (status == 0xf0 || status == 0xf7) {
+            running = 0;
+            uint32_t l;
+            if (!read_varlen(buf, len, &pos, &l) || pos + l > len)
+                return false;
+            pos += l;
+            continue;
+        }
+
+        if (status >= 0xf0)  // not valid in a standard midi file
+            return false;
+
+        running = status;
+        ev.len = ((status >> 4) == MIDI_PROGRAM_CHANGE || (status >> 4) == MIDI_CHANNEL_PRESSURE) ? 1 : 2;
+        if (pos + ev.len > len)
+            return false;
+        for (uint8_t i = 0; i < ev.len; i++)
+            ev.data[i] = buf[pos++] & 0x7f;
+        if (!events_append(e, &ev))
+            return false;
+    }
+
+    return true;
+}
+
+
+static bool
+parse_smf(const uint8_t *buf, size_t len, events_t *e, uint16_t *division)
+{
+    if (len < 14 || memcmp(buf, "MThd", 4) != 0 || read_be(buf + 4, 4) < 6) {
+        fprintf(stderr, "error: not a standard midi file\n");
+        return false;
+    }
+
+    uint16_t format = read_be(buf + 8, 2);
+    uint16_t ntrks = read_be(buf + 10, 2);
+    *division = read_be(buf + 12, 2);
+
+    if (format > 1) {
+        fprintf(stderr, "error: unsupported standard midi file format: %d\n", format);
+        return false;
+    }
+    if (*division == 0) {
+        fprintf(stderr, "error: invalid time division\n");
+        return false;
+    }
+
+    uint32_t order = 0;
+    size_t pos = 8 + read_be(buf + 4, 4);
+    for (uint16_t i = 0; i < ntrks; i++) {
+        if (pos + 8 > len) {
+            fprintf(stderr, "error: truncated midi file\n");
+            return false;
+        }
+        uint32_t l = read_be(buf + pos + 4, 4);
+        if (pos + 8 + l > len) {
+            fprintf(stderr, "error: truncated midi file\n");
+            return false;
+        }
+        if (memcmp(buf + pos, "MTrk", 4) == 0) {
+            if (!parse_track(buf + pos + 8, l, e, &order)) {
+                fprintf(stderr, "error: invalid midi track: %d\n", i);
+                return false;
+            }
+        }
+        pos += 8 + l;
+    }
+
+    qsort(e->events, e->len, sizeof(event_t), events_cmp);
+    return true;
+}
+
+
+static bool
+write_wav_header(FILE *f, uint32_t samples)
+{
+    uint32_t data_len = samples * 2;
+    uint8_t hdr[44];
+    memcpy(hdr, "RIFF", 4);
+    memcpy(hdr + 8, "WAVEfmt ", 8);
+    memcpy(hdr + 36, "data", 4);
+
+    uint32_t vals[][2] = {
+        {4, 36 + data_len},
+        {16, 16},                // fmt chunk size
+        {20, 1 | (1 << 16)},     // pcm, mono
+        {24, sample_rate},
+        {28, sample_rate * 2},   // byte rate
+        {32, 2 | (16 << 16)},    // block align, bits per sample
+        {40, data_len},
+    };
+    for (size_t i = 0; i < sizeof(vals) / sizeof(vals[0]); i++)
+        for (uint8_t j = 0; j < 4; j++)
+            hdr[vals[i][0] + j] = vals[i][1] >> (8 * j);
+
+    return fwrite(hdr, sizeof(hdr), 1, f) == 1;
+}
+
+
+static bool
+load_settings(const char *path, settings_data_t *data)
+{
+    memcpy(data, &factory_settings, sizeof(settings_data_t));
+    if (path == NULL)
+        return true;
+
+    size_t len;
+    uint8_t *buf = read_file(path, &len);
+    if (buf == NULL)
+        return false;
+
+    if (len < sizeof(settings_data_t)) {
+        fprintf(stderr, "error: settings file too short\n");
+        free(buf);
+        return false;
+    }
+
+    // same as the firmware, settings with a different version are ignored.
+    const settings_data_t *s = (const settings_data_t*) buf;
+    if (s->version == SETTINGS_VERSION)
+        memcpy(data, buf, sizeof(settings_data_t));
+    else
+        fprintf(stderr, "warning: unsupported settings version (%d), using factory settings\n", s->version);
+
+    free(buf);
+    return true;
+}
+
+
+int
+main(int argc, char **argv)
+{
+    const char *settings_file = NULL;
+    uint32_t tail = 1000;
+
+    int c;
+    while ((c = getopt(argc, argv, "hs:t:")) != -1) {
+        switch (c) {
+        case 'h':
+            usage(stdout);
+            return 0;
+
+        case 's':
+            settings_file = optarg;
+            break;
+
+        case 't':
+            tail = strtoul(optarg, NULL, 10);
+            break;
+
+        default:
+            usage(stderr);
+            return 1;
+        }
+    }
+
+    if (argc - optind != 2) {
+        usage(stderr);
+        return 1;
+    }
+
+    settings_data_t settings;
+    if (!load_settings(settings_file, &settings))
+        return 1;
+
+    size_t smf_len;
+    uint8_t *smf = read_file(argv[optind], &smf_len);
+    if (smf == NULL)
+        return 1;
+
+    events_t events = {0};
+    uint16_t division;
+    bool ok = parse_smf(smf, smf_len, &events, &division);
+    free(smf);
+    if (!ok) {
+        free(events.events);
+        return 1;
+    }
+
+    FILE *out = fopen(argv[optind + 1], "wb");
+    if (out == NULL) {
+        perror(argv[optind + 1]);
+        free(events.events);
+        return 1;
+    }
+
+    synth_t synth = {0};
+    synth_init(&synth, NULL, NULL);
+    synth_set_param(&synth, SYNTH_PARAM_OSCILLATOR_WAVEFORM, settings.oscillator.waveform);
+    synth_set_param(&synth, SYNTH_PARAM_PORTAMENTO, settings.oscillator.portamento);
+    synth_set_param(&synth, SYNTH_PARAM_PORTAMENTO_TIME, settings.oscillator.portamento_time);
+    synth_set_param(&synth, SYNTH_PARAM_PULSE_WIDTH, settings.oscillator.pulse_width);
+    synth_set_param(&synth, SYNTH_PARAM_SUB_LEVEL, settings.oscillator.sub_level);
+    synth_set_param(&synth, SYNTH_PARAM_SUB_OCTAVE, settings.oscillator.sub_octave);
+    synth_set_param(&synth, SYNTH_PARAM_FM_RATIO, settings.oscillator.fm_ratio);
+    synth_set_param(&synth, SYNTH_PARAM_FM_INDEX, settings.oscillator.fm_index);
+    synth_set_param(&synth, SYNTH_PARAM_FM_ENVELOPE, settings.oscillator.fm_envelope);
+    synth_set_param(&synth, SYNTH_PARAM_SYNC_INTERVAL, settings.oscillator.sync_interval);
+    synth_set_param(&synth, SYNTH_PARAM_NOTE_PRIORITY, settings.note_priority);
+    synth_set_param(&synth, SYNTH_PARAM_LEGATO, settings.legato);
+    synth_set_param(&synth, SYNTH_PARAM_ADSR_TYPE, settings.adsr.type);
+    synth_set_param(&synth, SYNTH_PARAM_ADSR_ATTACK, settings.adsr.attack);
+    synth_set_param(&synth, SYNTH_PARAM_ADSR_DECAY, settings.adsr.decay);
+    synth_set_param(&synth, SYNTH_PARAM_ADSR_SUSTAIN, settings.adsr.sustain);
+    synth_set_param(&synth, SYNTH_PARAM_ADSR_RELEASE, settings.adsr.release);
+    synth_set_param(&synth, SYNTH_PARAM_FILTER_TYPE, settings.filter.type);
+    synth_set_param(&synth, SYNTH_PARAM_FILTER_CUTOFF, settings.filter.cutoff);
+    synth_set_param(&synth, SYNTH_PARAM_LFO_WAVEFORM, settings.lfo.waveform);
+    synth_set_param(&synth, SYNTH_PARAM_LFO_RATE, settings.lfo.rate);
+    synth_set_param(&synth, SYNTH_PARAM_LFO_DEPTH, settings.lfo.depth);
+    synth_set_param(&synth, SYNTH_PARAM_LFO_DESTINATION, settings.lfo.destination);
+
+    // placeholder, rewritten once the number of samples is known
+    if (!write_wav_header(out, 0)) {
+        perror(argv[optind + 1]);
+        fclose(out);
+        free(events.events);
+        return 1;
+    }
+
+    // smpte divisions have a fixed tick length, otherwise it depends on tempo.
+    double tick_seconds = 0;
+    if (division & 0x8000) {
+        int8_t fps = -(int8_t) (division >> 8);
+        tick_seconds = 1. / ((fps == 29 ? 29.97 : fps) * (division & 0xff));
+    }
+    else {
+        tick_seconds = 500000e-6 / division;
+    }
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    // events are applied at block boundaries, as the firmware does.
+    uint64_t samples = 0;
+    uint64_t last_tick = 0;
+    double seconds = 0;
+    size_t idx = 0;
+    uint64_t end = 0;
+    bool done = false;
+    while (!done) {
+        while (idx < events.len) {
+            event_t *ev = &events.events[idx];
+            double t = seconds + (ev->tick - last_tick) * tick_seconds;
+            if ((uint64_t) (t * sample_rate) > samples)
+                break;
+
+            seconds = t;
+            last_tick = ev->tick;
+            idx++;
+
+            if (ev->status == 0xff) {
+                if (!(division & 0x8000))
+                    tick_seconds = ev->tempo * 1e-6 / division;
+                continue;
+            }
+
+            if ((ev->status & 0xf) != settings.midi_channel)
+                continue;
+
+            synth_midi_channel(&synth, ev->status >> 4, ev->data, ev->len);
+        }
+
+        if (idx == events.len && end == 0)
+            end = samples + (uint64_t) tail * sample_rate / 1000;
+
+        uint16_t block[synth_block_len];
+        synth_render_block(&synth, block, synth_block_len);
+
+        int16_t pcm[synth_block_len];
+        for (uint8_t i = 0; i < synth_block_len; i++) {
+            int16_t v = (int16_t) block[i] - output_offset;
+            pcm[i] = v * (1 << 6);
+        }
+
+        uint8_t le[synth_block_len * 2];
+        for (uint8_t i = 0; i < synth_block_len; i++) {
+            le[2 * i] = pcm[i];
+            le[2 * i + 1] = (uint16_t) pcm[i] >> 8;
+        }
+        if (fwrite(le, sizeof(le), 1, out) != 1) {
+            perror(argv[optind + 1]);
+            fclose(out);
+            free(events.events);
+            return 1;
+        }
+
+        samples += synth_block_len;
+        done = end != 0 && samples >= end;
+    }
+
+    struct timespec stop;
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    free(events.events);
+
+    if (samples > UINT32_MAX / 2 - 36) {
+        fprintf(stderr, "error: rendered audio too long for a wav file\n");
+        fclose(out);
+        return 1;
+    }
+
+    if (fseek(out, 0, SEEK_SET) != 0 || !write_wav_header(out, samples)) {
+        perror(argv[optind + 1]);
+        fclose(out);
+        return 1;
+    }
+    fclose(out);
+
+    double elapsed = (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) * 1e-9;
+    fprintf(stderr, "rendered %llu samples (%.2fs) in %.3fs, %.0f samples/s (%.1fx realtime)\n",
+        (unsigned long long) samples, (double) samples / sample_rate, elapsed,
+        elapsed > 0 ? samples / elapsed : 0, elapsed > 0 ? samples / elapsed / sample_rate : 0);
+
+    return 0;
+}
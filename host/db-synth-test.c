@@ -0,0 +1,74 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// checks that the portable replacements for the avr assembly blocks are
+// bit-exact. the expected values were computed with a byte by byte model of
+// the avr instructions, rounding included.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// the multiply helpers are static, include their sources directly.
+#include "adsr.c"
+#include "amplifier.c"
+
+static const struct {
+    uint16_t range_start;
+    uint16_t range_end;
+    uint16_t balance;
+    uint16_t expected;
+} blend_cases[] = {
+    {0x0000, 0xffff, 0xffff, 0xfffd},
+    {0xffff, 0x0000, 0x0000, 0xfffd},
+    {0x1234, 0xc0c0, 0x8000, 0x6979},
+    {0xfe01, 0x0101, 0x7fff, 0x7f80},
+    {0xabcd, 0x5432, 0x00ff, 0xab74},
+};
+
+static const struct {
+    int16_t in;
+    uint16_t level1;
+    uint8_t level2;
+    int16_t expected;
+} amplify_cases[] = {
+    {32767, 0xffff, 0xfe, 32509},
+    {-32768, 0xffff, 0xfe, -32512},
+    {-1, 0xffff, 0xff, -2},
+    {0x1234, 0x8000, 0x80, 1165},
+    {-12345, 0xc0c0, 0xc8, -7263},
+    {300, 0x00ff, 0x01, 0},
+};
+
+
+int
+main(void)
+{
+    int rv = 0;
+
+    for (size_t i = 0; i < sizeof(blend_cases) / sizeof(blend_cases[0]); i++) {
+        uint16_t got = blend(blend_cases[i].range_start, blend_cases[i].range_end, blend_cases[i].balance);
+        if (got != blend_cases[i].expected) {
+            fprintf(stderr, "blend(0x%04x, 0x%04x, 0x%04x) = 0x%04x, expected 0x%04x\n",
+                blend_cases[i].range_start, blend_cases[i].range_end, blend_cases[i].balance,
+                got, blend_cases[i].expected);
+            rv = 1;
+        }
+    }
+
+    for (size_t i = 0; i < sizeof(amplify_cases) / sizeof(amplify_cases[0]); i++) {
+        int16_t got = amplifier_get_sample(amplify_cases[i].in, amplify_cases[i].level1, amplify_cases[i].level2);
+        if (got != amplify_cases[i].expected) {
+            fprintf(stderr, "amplify(%d, 0x%04x, 0x%02x) = %d, expected %d\n",
+                amplify_cases[i].in, amplify_cases[i].level1, amplify_cases[i].level2,
+                got, amplify_cases[i].expected);
+            rv = 1;
+        }
+    }
+
+    return rv;
+}
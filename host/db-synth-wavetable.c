@@ -0,0 +1,234 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+// converts a single cycle wav file to the sysex messages that upload it to a
+// user wavetable slot, with one band-limited level per octave.
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "main-data.h"
+
+// must match firmware/wavetable.h, that can't be included by host tools.
+#define wavetable_levels 10
+#define wavetable_samples 512
+#define wavetable_slots 3
+#define wavetable_sysex_id 0x57
+
+
+static void
+usage(FILE *f)
+{
+    fprintf(f,
+        "usage: db-synth-wavetable [-h] [-s SLOT] INPUT OUTPUT\n"
+        "\n"
+        "converts a single cycle 16-bit wav file (INPUT) to a sysex file (OUTPUT),\n"
+        "that uploads it to a user wavetable slot.\n"
+        "\n"
+        "options:\n"
+        "  -h       show this help message and exit\n"
+        "  -s SLOT  user wavetable slot, from 1 to %d (default: 1)\n",
+        wavetable_slots);
+}
+
+
+static uint32_t
+read_le(const uint8_t *buf, uint8_t n)
+{
+    uint32_t rv = 0;
+    for (uint8_t i = 0; i < n; i++)
+        rv |= (uint32_t) buf[i] << (8 * i);
+    return rv;
+}
+
+
+static double*
+read_wav(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        perror(path);
+        return NULL;
+    }
+
+    uint8_t hdr[12];
+    if (fread(hdr, sizeof(hdr), 1, f) != 1 || memcmp(hdr, "RIFF", 4) != 0 || memcmp(hdr + 8, "WAVE", 4) != 0) {
+        fprintf(stderr, "error: not a wav file: %s\n", path);
+        fclose(f);
+        return NULL;
+    }
+
+    uint16_t channels = 0;
+    double *rv = NULL;
+    bool reported = false;
+
+    uint8_t chunk[8];
+    while (fread(chunk, sizeof(chunk), 1, f) == 1) {
+        uint32_t l = read_le(chunk + 4, 4);
+
+        if (memcmp(chunk, "fmt ", 4) == 0) {
+            uint8_t fmt[16];
+            if (l < sizeof(fmt) || fread(fmt, sizeof(fmt), 1, f) != 1)
+                break;
+            if (read_le(fmt, 2) != 1 || read_le(fmt + 14, 2) != 16) {
+                fprintf(stderr, "error: only 16-bit pcm wav files are supported\n");
+                reported = true;
+                break;
+            }
+            channels = read_le(fmt + 2, 2);
+            l -= sizeof(fmt);
+        }
+        else if (memcmp(chunk, "data", 4) == 0 && channels != 0) {
+            // only the first channel is used
+            reported = true;
+            *len = l / (2 * channels);
+            if (*len < 2) {
+                fprintf(stderr, "error: wav file too short\n");
+                break;
+            }
+            rv = malloc(*len * sizeof(double));
+            if (rv == NULL) {
+                fprintf(stderr, "error: out of memory\n");
+                break;
+            }
+            for (size_t i = 0; i < *len; i++) {
+                uint8_t s[2];
+                if (fread(s, sizeof(s), 1, f) != 1 || fseek(f, 2 * (channels - 1), SEEK_CUR) != 0) {
+                    fprintf(stderr, "error: truncated wav file\n");
+                    free(rv);
+                    rv = NULL;
+                    break;
+                }
+                rv[i] = (int16_t) read_le(s, 2);
+            }
+            break;
+        }
+
+        if (fseek(f, l + (l & 1), SEEK_CUR) != 0)
+            break;
+    }
+
+    if (!reported)
+        fprintf(stderr, "error: invalid wav file: %s\n", path);
+    fclose(f);
+    return rv;
+}
+
+
+int
+main(int argc, char **argv)
+{
+    unsigned long slot = 1;
+
+    int c;
+    while ((c = getopt(argc, argv, "hs:")) != -1) {
+        switch (c) {
+        case 'h':
+            usage(stdout);
+            return 0;
+
+        case 's':
+            slot = strtoul(optarg, NULL, 10);
+            break;
+
+        default:
+            usage(stderr);
+            return 1;
+        }
+    }
+
+    if (argc - optind != 2 || slot < 1 || slot > wavetable_slots) {
+        usage(stderr);
+        return 1;
+    }
+
+    size_t len;
+    double *cycle = read_wav(argv[optind], &len);
+    if (cycle == NULL)
+        return 1;
+
+    // the whole file is a cycle, its harmonics are resynthesized at the
+    // wavetable length. the dc offset is dropped.
+    size_t harmonics = len / 2 < wavetable_samples / 2 ? len / 2 : wavetable_samples / 2 - 1;
+    double *re = calloc(harmonics + 1, sizeof(double));
+    double *im = calloc(harmonics + 1, sizeof(double));
+    if (re == NULL || im == NULL) {
+        fprintf(stderr, "error: out of memory\n");
+        free(cycle);
+        free(re);
+        free(im);
+        return 1;
+    }
+    for (size_t k = 1; k <= harmonics; k++) {
+        for (size_t i = 0; i < len; i++) {
+            double p = 2 * M_PI * k * i / len;
+            re[k] += cycle[i] * cos(p);
+            im[k] -= cycle[i] * sin(p);
+        }
+    }
+    free(cycle);
+
+    FILE *out = fopen(argv[optind + 1], "wb");
+    if (out == NULL) {
+        perror(argv[optind + 1]);
+        free(re);
+        free(im);
+        return 1;
+    }
+
+    // same as the builtin wavetables, each octave only has the harmonics
+    // below nyquist at the start of the next octave, the highest pitch that
+    // the crossfade reads from it. all the levels are scaled by the same
+    // factor, so that the volume does not change between octaves.
+    static double samples[wavetable_levels][wavetable_samples];
+    double peak = 0;
+    for (uint8_t level = 0; level < wavetable_levels; level++) {
+        double f = 440 * pow(2, (12 * (level + 1) - 69) / 12.);
+        size_t n = sample_rate / 2 / f;
+        if (n > harmonics)
+            n = harmonics;
+
+        for (uint16_t i = 0; i < wavetable_samples; i++) {
+            for (size_t k = 1; k <= n; k++) {
+                double p = 2 * M_PI * k * i / wavetable_samples;
+                samples[level][i] += re[k] * cos(p) - im[k] * sin(p);
+            }
+            if (fabs(samples[level][i]) > peak)
+                peak = fabs(samples[level][i]);
+        }
+    }
+
+    int rv = 0;
+    for (uint8_t level = 0; level < wavetable_levels; level++) {
+        uint8_t msg[5 + 2 * wavetable_samples + 2] = {0xf0, 0x7d, wavetable_sysex_id, slot - 1, level};
+        uint8_t checksum = msg[3] + msg[4];
+        for (uint16_t i = 0; i < wavetable_samples; i++) {
+            uint8_t s = (int8_t) lround(peak > 0 ? samples[level][i] * 127 / peak : 0);
+            msg[5 + 2 * i] = s >> 4;
+            msg[5 + 2 * i + 1] = s & 0xf;
+            checksum += msg[5 + 2 * i] + msg[5 + 2 * i + 1];
+        }
+        msg[sizeof(msg) - 2] = checksum & 0x7f;
+        msg[sizeof(msg) - 1] = 0xf7;
+
+        if (fwrite(msg, sizeof(msg), 1, out) != 1) {
+            perror(argv[optind + 1]);
+            rv = 1;
+            break;
+        }
+    }
+
+    free(re);
+    free(im);
+    fclose(out);
+    return rv;
+}
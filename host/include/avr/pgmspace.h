@@ -0,0 +1,23 @@
+/*
+ * db-synth: A MIDI-controlled mono-voice digital synthesizer built on top of the
+ *           AVR DB microcontroller series.
+ *
+ * SPDX-FileCopyrightText: 2026 Rafael G. Martins <rafael@rafaelmartins.eng.br>
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#pragma once
+
+// minimal replacement of the avr-libc header, to build the dsp code on the host.
+// program memory is just regular memory here.
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+
+#define pgm_read_byte(addr) (*((const uint8_t*) (addr)))
+#define pgm_read_word(addr) (*((const uint16_t*) (addr)))
+#define pgm_read_dword(addr) (*((const uint32_t*) (addr)))
+
+#define memcpy_P(dest, src, n) memcpy((dest), (src), (n))